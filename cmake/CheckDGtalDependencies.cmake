@@ -70,3 +70,9 @@ endif()
 if (UNIX AND NOT(APPLE))
   SET(DGtalLibDependencies ${DGtalLibDependencies} -lrt)
 endif()
+
+# -----------------------------------------------------------------------------
+# Looking for threads (std::thread)
+# -----------------------------------------------------------------------------
+FIND_PACKAGE(Threads REQUIRED)
+SET(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
@@ -140,29 +140,35 @@ namespace DGtal
     /**
      *  Constructor in the non-periodic case.
      *
-     * See documentation of VoronoiMap constructor.
+     * See documentation of VoronoiMap constructor (an updatable
+     * distance transformation is updated by VoronoiMap::update).
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           const bool updatable = false):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          updatable)
     {}
 
     /**
      *  Constructor with periodicity specification.
      *
-     * See documentation of VoronoiMap constructor.
+     * See documentation of VoronoiMap constructor (an updatable
+     * distance transformation is updated by VoronoiMap::update).
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
                            ConstAlias<SeparableMetric> aMetric,
-                           typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           const bool updatable = false)
       : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                             predicate,
                                                                             aMetric,
-                                                                            aPeriodicitySpec)
+                                                                            aPeriodicitySpec,
+                                                                            updatable)
     {}
 
     /**
@@ -56,48 +56,13 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace detail
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) const
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -122,8 +87,14 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a priority queue of candidates,
+   * by default a STL set of pairs (point, tentative value)
+   * (SetCandidateQueue). For large propagations on a HyperRectDomain,
+   * use IndexedHeapCandidateQueue, a binary heap with decrease-key
+   * which also keeps the accepted flags in a bitset over the domain,
+   * or UntidyBucketCandidateQueue, a bucket queue in constant time per
+   * operation but which slightly approximates the order of the
+   * accepted points.
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -131,6 +102,8 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidateQueue  the queue of candidate points
+   * (SetCandidateQueue, IndexedHeapCandidateQueue or UntidyBucketCandidateQueue).
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMSimpleTypeDef3D
@@ -146,7 +119,8 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TCandidateQueue = SetCandidateQueue<TSet, typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -177,13 +151,15 @@ namespace DGtal
     typedef TPointFunctor PointFunctor; 
     typedef typename PointFunctor::Value Value; 
 
+    //candidates
+    typedef TCandidateQueue CandidatePointQueue; 
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename CandidatePointQueue::Point >::value ));
+
 
   private: 
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
     typedef DGtal::uint64_t Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -200,9 +176,9 @@ namespace DGtal
     AcceptedPointSet& myAcceptedPoints; 
 
     /**
-     * Set of candidate points
+     * Queue of candidate points
      */
-    CandidatePointSet myCandidatePoints; 
+    CandidatePointQueue myCandidatePoints; 
 
     /**
      * Pointer on the point functor used to deduce 
@@ -520,9 +496,10 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor,
+            typename TCandidateQueue >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidateQueue> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,529 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidateQueues.h
+ *
+ * @date 2026/10/16
+ *
+ * @brief Priority queues of candidate points for the Fast Marching Method
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see FMM.h
+ */
+
+#if defined(FMMCandidateQueues_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidateQueues.h
+#else // defined(FMMCandidateQueues_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidateQueues_RECURSES
+
+#if !defined FMMCandidateQueues_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidateQueues_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SetCandidateQueue
+  /**
+   * Description of template class 'SetCandidateQueue' <p>
+   * \brief Aim: Queue of the candidate points of FMM, ordered by
+   * their (absolute) tentative distance value, stored in a STL set of
+   * pairs (point, tentative value).
+   *
+   * This is the default queue of FMM. A point may be pushed several
+   * times with different values: the pair of smallest value comes
+   * first, the other ones are popped later and ignored by FMM since
+   * the point is then accepted. The accepted points are those of the
+   * set given at construction.
+   *
+   * The candidate queues of FMM all provide the following services:
+   * - construction from the set of accepted points,
+   * - push(p, v): adds the point p with the tentative value v,
+   * - top(), pop(), empty(), size(), clear(): as for a priority queue of
+   * pairs (point, value), the smallest absolute value coming first,
+   * - accept(p): marks p as accepted,
+   * - isAccepted(p): 'true' if p has been accepted.
+   *
+   * @tparam TSet any model of CDigitalSet, the set of accepted points.
+   * @tparam TValue the type of the distance values.
+   *
+   * @see IndexedHeapCandidateQueue
+   * @see UntidyBucketCandidateQueue
+   */
+  template <typename TSet, typename TValue>
+  class SetCandidateQueue
+  {
+  public:
+    typedef TSet AcceptedPointSet;
+    typedef typename TSet::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef typename std::set<PointValue,
+                              detail::PointValueCompare<PointValue> >::size_type Size;
+
+    /**
+     * Constructor.
+     * @param aSet the set of accepted points (aliased).
+     */
+    SetCandidateQueue( const AcceptedPointSet & aSet )
+      : mySet( &aSet ) {}
+
+    /**
+     * Adds a candidate point.
+     * @param aPoint the point.
+     * @param aValue its tentative value.
+     */
+    void push( const Point & aPoint, const Value & aValue )
+    {
+      myPairs.insert( PointValue( aPoint, aValue ) );
+    }
+
+    /**
+     * @pre the queue is not empty.
+     * @return the pair of smallest absolute value.
+     */
+    const PointValue & top() const
+    {
+      return *myPairs.begin();
+    }
+
+    /**
+     * Removes the pair of smallest absolute value.
+     * @pre the queue is not empty.
+     */
+    void pop()
+    {
+      myPairs.erase( myPairs.begin() );
+    }
+
+    /**
+     * @return 'true' if there is no candidate.
+     */
+    bool empty() const
+    {
+      return myPairs.empty();
+    }
+
+    /**
+     * @return the number of pairs of the queue.
+     */
+    Size size() const
+    {
+      return myPairs.size();
+    }
+
+    /**
+     * Removes all the candidates.
+     */
+    void clear()
+    {
+      myPairs.clear();
+    }
+
+    /**
+     * Does nothing: the accepted points are those of the set.
+     */
+    void accept( const Point & )
+    {}
+
+    /**
+     * @param aPoint any point.
+     * @return 'true' if @a aPoint belongs to the set of accepted points.
+     */
+    bool isAccepted( const Point & aPoint ) const
+    {
+      return mySet->find( aPoint ) != mySet->end();
+    }
+
+  private:
+    /// Set of accepted points
+    const AcceptedPointSet * mySet;
+    /// Pairs (point, tentative value)
+    std::set<PointValue, detail::PointValueCompare<PointValue> > myPairs;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedHeapCandidateQueue
+  /**
+   * Description of template class 'IndexedHeapCandidateQueue' <p>
+   * \brief Aim: Queue of the candidate points of FMM, stored in a
+   * binary heap of linearized point indices with a decrease-key
+   * operation.
+   *
+   * The heap position of each point of the domain of the accepted
+   * point set is stored in an array, so that a point pushed again
+   * with a smaller value is moved up in the heap instead of being
+   * inserted again. The accepted points are marked in a bitset over
+   * the domain. Ties are broken by linearized index.
+   *
+   * All the operations are in O(log n), n being the number of
+   * candidates, without memory allocation after the first ones, but
+   * the memory footprint is proportional to the domain size.
+   *
+   * @pre the points accepted by the point predicate of FMM lie
+   * within the domain of the accepted point set.
+   *
+   * @tparam TSet any model of CDigitalSet on a HyperRectDomain.
+   * @tparam TValue the type of the distance values.
+   *
+   * @see SetCandidateQueue for the services.
+   */
+  template <typename TSet, typename TValue>
+  class IndexedHeapCandidateQueue
+  {
+  public:
+    typedef TSet AcceptedPointSet;
+    typedef typename TSet::Domain Domain;
+    typedef typename TSet::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef typename Domain::Space::Size Size;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain< typename Domain::Space > >::value ));
+
+    /**
+     * Constructor.
+     * @param aSet the set of accepted points, whose domain is
+     * indexed.
+     */
+    IndexedHeapCandidateQueue( const AcceptedPointSet & aSet );
+
+    /**
+     * Adds a candidate point, or decreases its value if it is
+     * already a candidate with a greater absolute value.
+     * @param aPoint the point.
+     * @param aValue its tentative value.
+     */
+    void push( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @pre the queue is not empty.
+     * @return the pair of smallest absolute value.
+     */
+    PointValue top() const;
+
+    /**
+     * Removes the pair of smallest absolute value.
+     * @pre the queue is not empty.
+     */
+    void pop();
+
+    /**
+     * @return 'true' if there is no candidate.
+     */
+    bool empty() const
+    {
+      return myHeap.empty();
+    }
+
+    /**
+     * @return the number of candidates.
+     */
+    Size size() const
+    {
+      return myHeap.size();
+    }
+
+    /**
+     * Removes all the candidates (the accepted points remain accepted).
+     */
+    void clear();
+
+    /**
+     * Marks a point as accepted.
+     * @param aPoint a point of the domain.
+     */
+    void accept( const Point & aPoint )
+    {
+      myAccepted[ index( aPoint ) ] = true;
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return 'true' if @a aPoint has been accepted.
+     */
+    bool isAccepted( const Point & aPoint ) const
+    {
+      return myAccepted[ index( aPoint ) ];
+    }
+
+  private:
+    /// Heap entry: linearized index and tentative value
+    struct Entry
+    {
+      Size index;
+      Value value;
+    };
+
+    /**
+     * @return 'true' if @a a comes before @a b.
+     */
+    static bool before( const Entry & a, const Entry & b )
+    {
+      const Value va = std::abs( a.value );
+      const Value vb = std::abs( b.value );
+      return ( va < vb ) || ( ( va == vb ) && ( a.index < b.index ) );
+    }
+
+    /**
+     * @return the linearized index of a point of the domain.
+     */
+    Size index( const Point & aPoint ) const
+    {
+      ASSERT( myDomain.isInside( aPoint ) );
+      return Linearizer<Domain>::getIndex( aPoint, myDomain.lowerBound(), myExtent );
+    }
+
+    /// Moves the entry at heap position @a i up, to its place.
+    void siftUp( Size i );
+    /// Moves the entry at heap position @a i down, to its place.
+    void siftDown( Size i );
+
+    /// Position meaning 'not in the heap'
+    static const Size npos;
+    /// Indexed domain
+    Domain myDomain;
+    /// Extent of the domain
+    Point myExtent;
+    /// Binary heap
+    std::vector<Entry> myHeap;
+    /// Heap position of each point of the domain
+    std::vector<Size> myPositions;
+    /// Accepted flags of the points of the domain
+    std::vector<bool> myAccepted;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class UntidyBucketCandidateQueue
+  /**
+   * Description of template class 'UntidyBucketCandidateQueue' <p>
+   * \brief Aim: Queue of the candidate points of FMM, stored in
+   * buckets of tentative values (untidy priority queue
+   * @cite Yatziv2006), in O(1) per operation.
+   *
+   * The absolute values are split into buckets of width
+   * 1/TBucketsPerUnit, kept in a growing circular array starting at
+   * the bucket of the last popped value. The candidates of a bucket
+   * are popped in reverse order of insertion, without sorting: a point
+   * may thus be accepted before a point of slightly smaller value of
+   * the same bucket, which adds an error bounded by the bucket width
+   * to the distance values. This is intended for bounded-speed
+   * problems (e.g. distances with unit grid steps), where the values
+   * increase by at most a few units from a point to its neighbors.
+   *
+   * A point pushed again gets a new entry, the former ones are
+   * skipped when met. The candidate and accepted points are marked in
+   * two bitsets over the domain of the accepted point set.
+   *
+   * @pre the points accepted by the point predicate of FMM lie
+   * within the domain of the accepted point set.
+   *
+   * @tparam TSet any model of CDigitalSet on a HyperRectDomain.
+   * @tparam TValue the type of the distance values.
+   * @tparam TBucketsPerUnit number of buckets per unit of distance
+   * (default 16, any positive number: the size of the circular array
+   * is rounded up to a power of two).
+   *
+   * @see SetCandidateQueue for the services.
+   */
+  template <typename TSet, typename TValue, unsigned int TBucketsPerUnit = 16>
+  class UntidyBucketCandidateQueue
+  {
+  public:
+    typedef TSet AcceptedPointSet;
+    typedef typename TSet::Domain Domain;
+    typedef typename TSet::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef typename Domain::Space::Size Size;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain< typename Domain::Space > >::value ));
+    BOOST_STATIC_ASSERT(( TBucketsPerUnit > 0 ));
+
+    /**
+     * Constructor.
+     * @param aSet the set of accepted points, whose domain is
+     * indexed.
+     */
+    UntidyBucketCandidateQueue( const AcceptedPointSet & aSet );
+
+    /**
+     * Adds a candidate point (with a new entry if it is already a
+     * candidate).
+     * @param aPoint the point.
+     * @param aValue its tentative value.
+     */
+    void push( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @pre the queue is not empty.
+     * @return the last pair pushed in the first non-empty bucket.
+     */
+    PointValue top();
+
+    /**
+     * Removes the pair returned by top().
+     * @pre the queue is not empty.
+     */
+    void pop();
+
+    /**
+     * @return 'true' if there is no candidate.
+     */
+    bool empty() const
+    {
+      return myCount == 0;
+    }
+
+    /**
+     * @return the number of candidates.
+     */
+    Size size() const
+    {
+      return myCount;
+    }
+
+    /**
+     * Removes all the candidates (the accepted points remain accepted).
+     */
+    void clear();
+
+    /**
+     * Marks a point as accepted.
+     * @param aPoint a point of the domain.
+     */
+    void accept( const Point & aPoint )
+    {
+      myAccepted[ index( aPoint ) ] = true;
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return 'true' if @a aPoint has been accepted.
+     */
+    bool isAccepted( const Point & aPoint ) const
+    {
+      return myAccepted[ index( aPoint ) ];
+    }
+
+  private:
+    /// Bucket entry: linearized index and tentative value
+    struct Entry
+    {
+      Size index;
+      Value value;
+    };
+
+    /**
+     * @return the linearized index of a point of the domain.
+     */
+    Size index( const Point & aPoint ) const
+    {
+      ASSERT( myDomain.isInside( aPoint ) );
+      return Linearizer<Domain>::getIndex( aPoint, myDomain.lowerBound(), myExtent );
+    }
+
+    /// Skips the former entries until the back of the current bucket
+    /// is a candidate.
+    void settle();
+
+    /// Indexed domain
+    Domain myDomain;
+    /// Extent of the domain
+    Point myExtent;
+    /// Circular array of buckets (its size is a power of two)
+    std::vector< std::vector<Entry> > myBuckets;
+    /// Number of the first bucket that may be non-empty
+    Size myCurrent;
+    /// Number of candidates
+    Size myCount;
+    /// Candidate flags of the points of the domain
+    std::vector<bool> myCandidates;
+    /// Accepted flags of the points of the domain
+    std::vector<bool> myAccepted;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidateQueues_h
+
+#undef FMMCandidateQueues_RECURSES
+#endif // else defined(FMMCandidateQueues_RECURSES)
@@ -0,0 +1,456 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file RawDistanceTransformation.h
+ * @brief Linear in time distance transformation without Voronoi map
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module RawDistanceTransformation.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testRawDistanceTransformation.cpp
+ */
+
+#if defined(RawDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in RawDistanceTransformation.h
+#else // defined(RawDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RawDistanceTransformation_RECURSES
+
+#if !defined RawDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define RawDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RawDistanceTransformation
+  /**
+   * Description of template class 'RawDistanceTransformation' <p>
+   * \brief Aim: Implementation of the linear in time distance
+   * transformation for separable metrics, storing raw distances
+   * instead of a Voronoi map.
+   *
+   * For each point of the domain, an instance stores the raw
+   * distance (see the metric rawDistance() method) to the closest
+   * site, i.e. point for which the predicate is false: the squared
+   * Euclidean distance for the @f$ l_2@f$ metric, the sum of @f$
+   * |x_i-y_i|^p@f$ for the @f$ l_p@f$ metrics. Unlike
+   * DistanceTransformation, which stores a Voronoi vector per point
+   * and computes the distance at each access, the image only stores
+   * one scalar per point (e.g. a DGtal::uint32_t or a float), which
+   * divides the memory footprint and bandwidth by up to 2d.
+   *
+   * The algorithm is the separable lower envelope computation of
+   * @cite Meijster2000 @cite Saito1994-DT: the image first stores the
+   * raw distance to the closest site on the same row along the first
+   * dimension, then each dimension in turn combines these partial
+   * distances along its rows. The separators between the sites are
+   * computed by a binary search, hence the metric raw distance must
+   * be the sum of per-dimension terms given by a convex increasing
+   * function of @f$ |x_i-y_i|@f$ (which is the case of
+   * ExactPredicateLpSeparableMetric and
+   * InexactPredicateLpSeparableMetric for @f$ p \geq 1@f$).  These
+   * terms are tabulated before each dimension is processed; when they
+   * are the squared differences (@f$ l_2@f$ metrics), the separators
+   * are computed in constant time, and the overall computation is in
+   * @f$ O(d.n^d)@f$.
+   *
+   * Periodicity is handled as in VoronoiMap: along a periodic
+   * dimension, a site is also seen through its translations by the
+   * domain extent.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the rows of each dimension are processed in parallel.
+   *
+   * This class is a model of concepts::CConstImage.
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   * @tparam TImageContainer any model of concepts::CImage to store the
+   * raw distances (default: ImageContainerBySTLVector of
+   * DGtal::uint32_t). The space of the image container and the TSpace
+   * should match, its domain must be HyperRectDomain, and its
+   * arithmetic value type must represent exactly the raw distances
+   * of the domain points (e.g. squared Euclidean distances up to
+   * @f$ 2^{32}-2@f$ for DGtal::uint32_t, @f$ 2^{24}@f$ for float).
+   * Its maximal value stands for the points without any site; larger
+   * raw distances are saturated to this maximal value minus one.
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TImageContainer =
+             ImageContainerBySTLVector<HyperRectDomain<TSpace>,
+                                       DGtal::uint32_t>
+             >
+  class RawDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< TImageContainer > ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //ImageContainer::Domain::Space must match with TSpace
+    BOOST_STATIC_ASSERT ((boost::is_same< TSpace,
+                          typename TImageContainer::Domain::Space >::value ));
+
+    //ImageContainer value type must be arithmetic
+    BOOST_STATIC_ASSERT (( boost::is_arithmetic<
+                           typename TImageContainer::Value >::value ));
+
+    //ImageContainer domain type must be  HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<TSpace>,
+                          typename TImageContainer::Domain >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the underlying domain type.
+    typedef typename TImageContainer::Domain Domain;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Type of the raw distances during the computation.
+    typedef typename SeparableMetric::RawValue RawValue;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Type of resulting image
+    typedef TImageContainer OutputImage;
+
+    ///Definition of the image value type.
+    typedef typename OutputImage::Value Value;
+
+    ///Definition of the image const range.
+    typedef typename OutputImage::ConstRange  ConstRange;
+
+    ///Self type
+    typedef RawDistanceTransformation< TSpace, TPointPredicate,
+                                       TSeparableMetric, TImageContainer > Self;
+
+    /// Periodicity specification type.
+    typedef std::array< bool, Space::dimension > PeriodicitySpec;
+
+    /**
+     * Constructor in the non-periodic case.
+     *
+     * This constructor computes the raw distance transformation of
+     * a set of point sites using a SeparableMetric metric, on a
+     * non-periodic domain.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     */
+    RawDistanceTransformation( ConstAlias<Domain> aDomain,
+                               ConstAlias<PointPredicate> predicate,
+                               ConstAlias<SeparableMetric> aMetric );
+
+    /**
+     * Constructor with periodicity specification.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aPeriodicitySpec an array of size equal to the space dimension
+     *        where the i-th value is \c true if the i-th dimension of the
+     *        space is periodic, \c false otherwise.
+     *
+     * @param nbSteps the number of processed dimensions: only the
+     * dimensions 0 to @a nbSteps - 1 are processed, hence the values
+     * are the raw distances to the closest sites in the same
+     * @a nbSteps-dimensional slice of the domain (e.g. the same
+     * row if @a nbSteps is 1).
+     */
+    RawDistanceTransformation( ConstAlias<Domain> aDomain,
+                               ConstAlias<PointPredicate> predicate,
+                               ConstAlias<SeparableMetric> aMetric,
+                               PeriodicitySpec const & aPeriodicitySpec,
+                               const Dimension nbSteps = Space::dimension );
+
+    /**
+     * Default destructor
+     */
+    ~RawDistanceTransformation() = default;
+
+    /**
+     * Disabling default constructor.
+     */
+    RawDistanceTransformation() = delete;
+
+  public:
+    // ------------------- ConstImage model ------------------------
+
+    /**
+     * Returns a reference (const) to the domain.
+     * @return a domain
+     */
+    const Domain &  domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * Returns a const range on the raw distances.
+     *  @return a const range
+     */
+    ConstRange constRange() const
+    {
+      return myImagePtr->constRange();
+    }
+
+    /**
+     * Access to the raw distance to the closest site at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the raw distance, or infinity() if there is no site.
+     */
+    Value operator()( const Point &aPoint ) const
+    {
+      return myImagePtr->operator()( aPoint );
+    }
+
+    /**
+     * @return the value of the points without any site.
+     */
+    static Value infinity()
+    {
+      return NumberTraits<Value>::max();
+    }
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /** Periodicity specification.
+     *
+     * @returns the periodicity specification array.
+     */
+    PeriodicitySpec const & getPeriodicitySpec() const
+    {
+      return myPeriodicitySpec;
+    }
+
+    /** Periodicity specification along one dimensions.
+     *
+     * @param [in] n the dimension index.
+     * @return \c true if the n-th dimension is periodic, \c false otherwise.
+     */
+    bool isPeriodic( const Dimension n ) const
+    {
+      return myPeriodicitySpec[ n ];
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------- Row services ------------------------
+  public:
+
+    /**
+     * Raw distances along a dimension.
+     *
+     * @param [in] aMetric a metric.
+     * @param [in] dim a dimension.
+     * @param [in] aSize a number of raw distances.
+     * @param [out] powers the raw distances from the origin to the
+     * points k.e_dim, for k in [0, @a aSize).
+     * @return true if these raw distances are the squares k^2,
+     * false otherwise.
+     */
+    static bool rawDistances( const SeparableMetric &aMetric,
+                              const Dimension dim,
+                              const std::size_t aSize,
+                              std::vector<RawValue> &powers );
+
+    /**
+     * Lower envelope of the sites of a row.
+     *
+     * @param [in] partial the partial raw distances of the row
+     * points, RawValue maximal value if there is no site.
+     * @param [in] extent the number of row points.
+     * @param [in] periodic true if the row is periodic.
+     * @param [in] powers the raw distances along the row, indexed by
+     * the coordinate differences.
+     * @param [in] quadratic true if @a powers are the squared
+     * differences: the separators between sites are then computed in
+     * constant time instead of by a binary search.
+     * @param [out] output the raw distances of the row points.
+     * @return false if there is no site on the row (@a output is
+     * left unchanged).
+     */
+    static bool lowerEnvelope( const RawValue * partial,
+                               const Abscissa extent,
+                               const bool periodic,
+                               const std::vector<RawValue> &powers,
+                               const bool quadratic,
+                               RawValue * output );
+
+    /**
+     * Conversion of a raw distance to the image value type.
+     *
+     * @param [in] aRawValue a raw distance.
+     * @return @a aRawValue, or infinity() - 1 if it is not
+     * representable by a finite value of the image.
+     */
+    static Value saturate( const RawValue aRawValue );
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Compute the raw distance transformation, one dimension after
+     * the other.
+     *
+     * @param [in] nbSteps the number of processed dimensions.
+     */
+    void compute( const Dimension nbSteps );
+
+    /**
+     * Compute one step of the separable distance transformation.
+     *
+     * @param [in] dim the dimension to process
+     */
+    void computeOtherSteps( const Dimension dim ) const;
+
+    /**
+     * Given raw distances valid at dimension @a dim-1, this method
+     * updates them to make them consistent at dimension @a dim along
+     * the @a nbRows 1D spans along the dimension @a dim starting at
+     * @a row, @a row + (1,0,...), @a row + (2,0,...)... Values of
+     * consecutive rows are contiguous in the image storage, hence
+     * their values are read and written together.
+     *
+     * @param [in] row starting point of the first 1D process.
+     * @param [in] nbRows number of rows (1 if @a dim is 0).
+     * @param [in] dim dimension of the update.
+     * @param [in] powers the raw distances along dimension @a dim,
+     * indexed by the coordinate differences.
+     * @param [in] quadratic true if @a powers are the squared differences.
+     * @param [in,out] partial scratch buffer for the input raw distances.
+     * @param [in,out] output scratch buffer for the updated raw distances.
+     * @param [in,out] found scratch buffer for the rows having sites.
+     */
+    void computeOtherRows( const Point &row,
+                           const Abscissa nbRows,
+                           const Dimension dim,
+                           const std::vector<RawValue> &powers,
+                           const bool quadratic,
+                           std::vector<RawValue> &partial,
+                           std::vector<RawValue> &output,
+                           std::vector<bool> &found ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Raw distance image
+    CountedPtr<OutputImage> myImagePtr;
+
+    /// Periodicity along each dimension.
+    PeriodicitySpec myPeriodicitySpec;
+
+  }; // end of class RawDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RawDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RawDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P,
+            typename Sep, typename TI>
+  std::ostream&
+  operator<< ( std::ostream & out, const RawDistanceTransformation<S,P,Sep,TI> & object );
+
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/RawDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RawDistanceTransformation_h
+
+#undef RawDistanceTransformation_RECURSES
+#endif // else defined(RawDistanceTransformation_RECURSES)
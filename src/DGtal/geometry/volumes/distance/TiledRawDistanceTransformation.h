@@ -0,0 +1,354 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file TiledRawDistanceTransformation.h
+ * @brief Out-of-core distance transformation on tiled images
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module TiledRawDistanceTransformation.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testTiledRawDistanceTransformation.cpp
+ */
+
+#if defined(TiledRawDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in TiledRawDistanceTransformation.h
+#else // defined(TiledRawDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TiledRawDistanceTransformation_RECURSES
+
+#if !defined TiledRawDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define TiledRawDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/RawDistanceTransformation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TiledRawDistanceTransformation
+  /**
+   * Description of template class 'TiledRawDistanceTransformation' <p>
+   * \brief Aim: Out-of-core computation of a raw distance
+   * transformation (see RawDistanceTransformation) into a TiledImage,
+   * for domains whose distance map does not fit in memory.
+   *
+   * The separable computation is split as follows, @a d being the
+   * last dimension:
+   * - the domain is cut into slabs along dimension @a d, one slab per
+   * layer of tiles of the output TiledImage. The steps along the
+   * dimensions 0 to @a d-1 of each slab are computed in memory by a
+   * RawDistanceTransformation restricted to these dimensions, and the
+   * slab is written in the output image tile by tile.
+   * - the step along dimension @a d is computed on each column of
+   * tiles in turn: the values of the column are read tile by tile
+   * into a column buffer, updated, and written back tile by tile.
+   *
+   * Hence, at most one slab and one column of tiles are in memory,
+   * besides the tiles held by the cache of the TiledImage: e.g. for a
+   * @f$ 2048^3@f$ domain with @f$ 8^3@f$ tiles of DGtal::uint32_t, a
+   * slab takes 4 GB and a column buffer 2 GB (its values are stored as
+   * RawValue). The input is any point predicate, e.g. a threshold of
+   * another TiledImage (the image caches are thread-safe): since a
+   * slab is read row by row, its cache should hold a layer of tiles.
+   *
+   * Each slab and column is processed in parallel if DGtal has been
+   * built with OpenMP support (WITH_OPENMP flag set to "true"), the
+   * tiles are read and written sequentially. As each point is written
+   * twice through the TiledImage, a write-back cache policy
+   * (ImageCacheWritePolicyWB) should be used: with a write-through
+   * one, every write flushes its tile. With a write-back policy, the
+   * distances of the tiles in cache are not in the image of the
+   * factory when the constructor returns: the caller must flush the
+   * cache (TiledImage::flushCache) before reading that image directly,
+   * rather than through the TiledImage.
+   *
+   * Periodicity is handled as in RawDistanceTransformation. This
+   * class is a model of concepts::CConstImage.
+   *
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableMetric a model of concepts::CSeparableMetric
+   * @tparam TTiledImage a TiledImage on a HyperRectDomain (at least
+   * 2-dimensional) whose arithmetic values represent exactly the raw
+   * distances (see RawDistanceTransformation).
+   */
+  template < typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TTiledImage >
+  class TiledRawDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< TTiledImage > ));
+
+    ///Copy of the tiled image type.
+    typedef TTiledImage TiledImage;
+
+    ///Definition of the underlying domain type.
+    typedef typename TiledImage::Domain Domain;
+
+    ///Copy of the space type.
+    typedef typename Domain::Space Space;
+
+    //Domain type must be HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<Space>, Domain >::value ));
+
+    //Slabs need a dimension besides the last one
+    BOOST_STATIC_ASSERT (( Space::dimension >= 2 ));
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Definition of the image value type.
+    typedef typename TiledImage::Value Value;
+
+    ///Image of a slab.
+    typedef ImageContainerBySTLVector<Domain, Value> SlabImage;
+
+    ///Computation of the slabs.
+    typedef RawDistanceTransformation<Space, PointPredicate,
+                                      SeparableMetric, SlabImage> SlabTransformation;
+
+    ///Type of the raw distances during the computation.
+    typedef typename SlabTransformation::RawValue RawValue;
+
+    ///Periodicity specification type.
+    typedef typename SlabTransformation::PeriodicitySpec PeriodicitySpec;
+
+    ///Definition of the image const range.
+    typedef DefaultConstImageRange<TiledRawDistanceTransformation> ConstRange;
+
+    /**
+     * Constructor in the non-periodic case. The raw distance
+     * transformation is computed into @a anImage.
+     *
+     * @param anImage the output tiled image, which defines the domain.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     */
+    TiledRawDistanceTransformation( Alias<TiledImage> anImage,
+                                    ConstAlias<PointPredicate> predicate,
+                                    ConstAlias<SeparableMetric> aMetric );
+
+    /**
+     * Constructor with periodicity specification. The raw distance
+     * transformation is computed into @a anImage.
+     *
+     * @param anImage the output tiled image, which defines the domain.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param aPeriodicitySpec an array of size equal to the space dimension
+     *        where the i-th value is \c true if the i-th dimension of the
+     *        space is periodic, \c false otherwise.
+     */
+    TiledRawDistanceTransformation( Alias<TiledImage> anImage,
+                                    ConstAlias<PointPredicate> predicate,
+                                    ConstAlias<SeparableMetric> aMetric,
+                                    PeriodicitySpec const & aPeriodicitySpec );
+
+    /**
+     * Default destructor
+     */
+    ~TiledRawDistanceTransformation() = default;
+
+    /**
+     * Disabling default constructor.
+     */
+    TiledRawDistanceTransformation() = delete;
+
+  public:
+    // ------------------- ConstImage model ------------------------
+
+    /**
+     * Returns a reference (const) to the domain.
+     * @return a domain
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * Returns a const range on the raw distances.
+     *  @return a const range
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Access to the raw distance to the closest site at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the raw distance, or infinity() if there is no site.
+     */
+    Value operator()( const Point &aPoint ) const
+    {
+      return myImagePtr->operator()( aPoint );
+    }
+
+    /**
+     * @return the value of the points without any site.
+     */
+    static Value infinity()
+    {
+      return SlabTransformation::infinity();
+    }
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /** Periodicity specification.
+     *
+     * @returns the periodicity specification array.
+     */
+    PeriodicitySpec const & getPeriodicitySpec() const
+    {
+      return myPeriodicitySpec;
+    }
+
+    /** Periodicity specification along one dimensions.
+     *
+     * @param [in] n the dimension index.
+     * @return \c true if the n-th dimension is periodic, \c false otherwise.
+     */
+    bool isPeriodic( const Dimension n ) const
+    {
+      return myPeriodicitySpec[ n ];
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Compute the slabs, then the columns.
+     */
+    void compute();
+
+    /**
+     * Compute the steps along the dimensions but the last one on a
+     * slab, and write it in the output image.
+     *
+     * @param [in] aLayer the block coordinate of the slab tiles along
+     * the last dimension.
+     */
+    void computeSlab( const Abscissa aLayer ) const;
+
+    /**
+     * Compute the step along the last dimension on a column of tiles.
+     *
+     * @param [in] aBlock the block coordinates of the first tile of
+     * the column.
+     * @param [in] powers the raw distances along the last dimension,
+     * indexed by the coordinate differences.
+     * @param [in] quadratic true if @a powers are the squared differences.
+     */
+    void computeColumn( const Point &aBlock,
+                        const std::vector<RawValue> &powers,
+                        const bool quadratic ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the output image
+    TiledImage * myImagePtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    /// Periodicity along each dimension.
+    PeriodicitySpec myPeriodicitySpec;
+
+  }; // end of class TiledRawDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TiledRawDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TiledRawDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename P, typename Sep, typename TI>
+  std::ostream&
+  operator<< ( std::ostream & out, const TiledRawDistanceTransformation<P,Sep,TI> & object );
+
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/TiledRawDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TiledRawDistanceTransformation_h
+
+#undef TiledRawDistanceTransformation_RECURSES
+#endif // else defined(TiledRawDistanceTransformation_RECURSES)
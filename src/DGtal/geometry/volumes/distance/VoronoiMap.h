@@ -204,10 +204,16 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param updatable if \c true, the maps computed after each
+     * dimension but the last one are kept, so that update() only
+     * recomputes the rows affected by an edit (this multiplies the
+     * memory footprint by the space dimension).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               const bool updatable = false);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +238,17 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param updatable if \c true, the maps computed after each
+     * dimension but the last one are kept, so that update() only
+     * recomputes the rows affected by an edit (this multiplies the
+     * memory footprint by the space dimension).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               const bool updatable = false);
     /**
      * Default destructor
      */
@@ -326,6 +338,32 @@ namespace DGtal
      */
     Point projectPoint( Point aPoint ) const;
 
+    /**
+     * @return \c true if the map has been constructed as updatable.
+     */
+    bool isUpdatable() const
+      {
+        return ! mySteps.empty();
+      }
+
+    /**
+     * Updates the Voronoi map after the predicate has changed on some
+     * points (e.g. after sites have been added to or removed from the
+     * underlying set). The result is identical to a new construction.
+     *
+     * If the map is updatable, the rows along the first dimension
+     * through the edited points are recomputed, then the rows along
+     * the second dimension through the points whose value has changed,
+     * and so on: the cost is proportional to the number of rows whose
+     * values change. Otherwise, the whole map is recomputed.
+     *
+     * @tparam TPointIterator a model of forward iterator on points.
+     * @param itb an iterator on the first edited point.
+     * @param ite an iterator after the last edited point.
+     */
+    template <typename TPointIterator>
+    void update( TPointIterator itb, TPointIterator ite );
+
     /**
      * Self Display method.
      *
@@ -352,16 +390,53 @@ namespace DGtal
      */
     void computeOtherSteps(const Dimension dim) const;
     /**
-     * Given  a voronoi map valid at dimension @a dim-1, this method
+     * Given a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
-     * the 1D span starting at @a row along the dimension @a
-     * dim.
+     * the @a nbRows 1D spans along the dimension @a dim starting at
+     * @a row, @a row + (1,0,...), @a row + (2,0,...)... The values of
+     * these rows are gathered in the contiguous buffer @a rows,
+     * processed by computeOtherStep1D, and scattered back to the map.
+     *
+     * @param [in] row starting point of the first 1D process.
+     * @param [in] nbRows number of rows (1 if @a dim is 0).
+     * @param [in] dim dimension of the update.
+     * @param [in,out] rows scratch buffer for the row values.
+     * @param [in,out] sites scratch buffer for the sites of a row.
+     */
+    void computeOtherRows (const Point &row,
+                           const Abscissa nbRows,
+                           const Dimension dim,
+                           std::vector<Point> &rows,
+                           std::vector<Point> &sites) const;
+
+    /**
+     * Given the values of a voronoi map valid at dimension @a dim-1
+     * along the 1D span starting at @a row along the dimension @a
+     * dim, this method updates them to make them consistent at
+     * dimension @a dim.
      *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] values the values of the 1D span, in increasing
+     * order of the coordinate along @a dim.
+     * @param [in,out] Sites scratch buffer for the sites of the span.
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             Point *values,
+                             std::vector<Point> &Sites) const;
+
+    /**
+     * Recomputes the rows along the dimension @a dim through some
+     * points of an updatable map.
+     *
+     * @param [in] dim dimension of the update.
+     * @param [in,out] changed the points whose value has changed at
+     * dimension @a dim-1 (the edited points if @a dim is 0); replaced
+     * by the points whose value has changed at dimension @a dim.
+     */
+    void updateStep (const Dimension dim,
+                     std::vector<Point> &changed) const;
 
     /**
      * Project a coordinate into the domain, taking into account
@@ -411,6 +486,10 @@ namespace DGtal
     /// Periodicity along each dimension.
     PeriodicitySpec myPeriodicitySpec;
 
+    /// Maps computed after each dimension but the last one (empty if
+    /// the map is not updatable).
+    std::vector< CountedPtr<OutputImage> > mySteps;
+
   }; // end of class VoronoiMap
 
   /**
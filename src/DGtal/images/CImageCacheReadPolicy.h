@@ -83,7 +83,7 @@ Description of \b concept '\b CImageCacheReadPolicy' <p>
 ### Invariants
 
 ### Models
-ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO
+ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO, ImageCacheReadPolicyLRU, ImageCacheReadPolicyARC
 
 ### Notes
 
@@ -255,6 +255,14 @@ public:
     {
         return myImagePtr;
     }
+
+    /**
+     * @return the functor applied to the values of the image.
+     */
+    const TFunctorV & valueFunctor() const
+    {
+        return *myFV;
+    }
     
     /**
      * Allows to define a default value returned when point 
@@ -40,7 +40,13 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -72,6 +78,35 @@ namespace DGtal
  *  - read :    for getting the value of an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - write :   for setting a   value on an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - update :  for updating the cache according to the read cache policy
+ *
+ * The cache is thread-safe: the policies are only used under a mutex
+ * held by the cache, and readOrUpdate, writeOrUpdate and
+ * getPageOrUpdate look up a page and update the cache on a miss
+ * atomically, so that several threads can share a cache (e.g. through
+ * a TiledImage). Pages returned by getPage and getPageOrUpdate may be
+ * detached by another thread updating the cache; pages returned by
+ * pinPageOrUpdate are pinned: a pinned page that the read policy
+ * detaches is flushed and leaves the cache, but it is only detached
+ * from the image factory once its last pin is released (so that the
+ * cache may hold more than the budget of its read policy meanwhile).
+ *
+ * The caches sharing a read policy (e.g. the caches of the copies of
+ * a TiledImage) share their mutex, their pins and their pages: a page
+ * detached through one of them is removed from the keyed slots of all
+ * of them.
+ *
+ * A cache built with a number of keys also provides keyed accesses
+ * (read, readOrUpdate and writeOrUpdate with a key, e.g. the index of a tile
+ * of a TiledImage): the page of each key is registered in a slot
+ * guarded by one of NbShards shard mutexes, so that read hits only
+ * lock the shard of their key and do not contend with the other keys
+ * nor with the cache mutex. The cache mutex is only waited for on a
+ * miss and on a write; when a thread reads a key other than its
+ * previous one, the access is passed to the read policy if the cache
+ * mutex is free.
+ *
+ * The cache counts the read and write hits and misses, and the
+ * detached pages (evictions).
  */
 template <typename TImageContainer, typename TImageFactory, typename TReadPolicy, typename TWritePolicy>
 class ImageCache
@@ -99,6 +134,9 @@ public:
     typedef TReadPolicy ReadPolicy;
     typedef TWritePolicy WritePolicy;
 
+    /// Number of mutexes guarding the slots of the keyed accesses
+    static const std::size_t NbShards = 64;
+
     // ----------------------- Standard services ------------------------------
 
 public:
@@ -108,22 +146,47 @@ public:
      * @param anImageFactory alias on the image factory (see ImageFactoryFromImage or ImageFactoryFromHDF5).
      * @param aReadPolicy a read policy.
      * @param aWritePolicy a write policy.
+     * @param aNbKeys the number of keys of the keyed accesses (0 to disable them).
      */
-    ImageCache(Alias<ImageFactory> anImageFactory, Alias<ReadPolicy> aReadPolicy, Alias<WritePolicy> aWritePolicy):
-      myImageFactoryPtr(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+    ImageCache(Alias<ImageFactory> anImageFactory, Alias<ReadPolicy> aReadPolicy, Alias<WritePolicy> aWritePolicy,
+               std::size_t aNbKeys = 0):
+      myImageFactoryPtr(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy),
+      myGroup(joinGroup(&aReadPolicy)), myMutex(myGroup->mutex), myNbPins(0),
+      mySlots(aNbKeys, (ImageContainer *)NULL)
     {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myGroup->caches.push_back(this);
       myReadPolicy->clearCache();
+      forgetPagesLocked();
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      cacheEviction = 0;
+      
+      for (std::size_t i = 0; i < NbShards; i++)
+      {
+        myShards[i].cacheHitRead = 0;
+        myShards[i].cacheHitWrite = 0;
+      }
     }
     
     /**
      * Destructor.
-     * Does nothing
+     * Leaves the group of the caches sharing the read policy.
      */
     ~ImageCache()
     {
+      std::lock_guard<std::mutex> registryLock(registryMutex());
+      {
+        std::lock_guard<std::mutex> lock(myMutex);
+        ASSERT(myNbPins == 0 && "ImageCache: a pinned page outlives the cache");
+        myGroup->caches.erase(std::find(myGroup->caches.begin(), myGroup->caches.end(), this));
+      }
+      // The group is only held by the registry and by this cache.
+      if (myGroup.use_count() == 2)
+        groups().erase(myReadPolicy);
     }
     
 private:
@@ -197,11 +260,113 @@ public:
      */
     void update(const Domain &aDomain);
     
+    /**
+     * Get the value of an image from cache at a given position given
+     * by aPoint, updating the cache with the domain aDomain if aPoint
+     * does not belong to an image from cache (read miss).
+     *
+     * @param aPoint the point.
+     * @param aDomain the domain containing aPoint to put in cache on a miss.
+     *
+     * @return the value at aPoint.
+     */
+    Value readOrUpdate(const Point & aPoint, const Domain & aDomain);
+    
+    /**
+     * Set a value on an image from cache at a given position given
+     * by aPoint, updating the cache with the domain aDomain if aPoint
+     * does not belong to an image from cache (write miss).
+     *
+     * @param aPoint the point.
+     * @param aDomain the domain containing aPoint to put in cache on a miss.
+     * @param aValue the value.
+     */
+    void writeOrUpdate(const Point & aPoint, const Domain & aDomain, const Value &aValue);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain,
+     * updating the cache with aDomain if no image in the cache matchs
+     * it (read miss).
+     *
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container.
+     */
+    ImageContainer * getPageOrUpdate(const Domain & aDomain);
+    
+    /**
+     * Get the page that matchs the domain aDomain, updating the cache
+     * with aDomain on a read miss, and pins it: the page is not
+     * detached from the image factory while the returned pointer (or
+     * one of its copies) is alive. The pointer must not outlive the
+     * cache.
+     *
+     * @param aDomain the domain.
+     *
+     * @return a pointer on the page, releasing the pin when destroyed.
+     */
+    std::shared_ptr<ImageContainer> pinPageOrUpdate(const Domain & aDomain);
+    
+    /**
+     * Writes the pages in cache to the image factory, according to
+     * the write policy (e.g. with ImageCacheWritePolicyWB, the values
+     * written in cache only reach the image of the factory when their
+     * page is flushed). The pages stay in cache.
+     */
+    void flushCache();
+    
+    /**
+     * @return the number of keys of the keyed accesses.
+     */
+    std::size_t nbKeys() const
+    {
+        return mySlots.size();
+    }
+    
+    /**
+     * Get the value of an image from cache at a given position given
+     * by aPoint only if the page of the key aKey is in cache. Only
+     * waits for the shard of aKey.
+     *
+     * @param aPoint the point.
+     * @param aKey the key of the domain containing aPoint (less than nbKeys()).
+     * @param aValue the value returned.
+     *
+     * @return 'true' if the page of aKey is in cache, 'false' otherwise.
+     */
+    bool read(const Point & aPoint, std::size_t aKey, Value &aValue);
+    
+    /**
+     * Get the value of an image from cache at a given position given
+     * by aPoint, updating the cache with the domain aDomain on a read
+     * miss. A read hit only locks the shard of aKey.
+     *
+     * @param aPoint the point.
+     * @param aDomain the domain containing aPoint to put in cache on a miss.
+     * @param aKey the key of aDomain (less than nbKeys()), the same for all the points of aDomain.
+     *
+     * @return the value at aPoint.
+     */
+    Value readOrUpdate(const Point & aPoint, const Domain & aDomain, std::size_t aKey);
+    
+    /**
+     * Set a value on an image from cache at a given position given
+     * by aPoint, updating the cache with the domain aDomain on a write
+     * miss.
+     *
+     * @param aPoint the point.
+     * @param aDomain the domain containing aPoint to put in cache on a miss.
+     * @param aKey the key of aDomain (less than nbKeys()), the same for all the points of aDomain.
+     * @param aValue the value.
+     */
+    void writeOrUpdate(const Point & aPoint, const Domain & aDomain, std::size_t aKey, const Value &aValue);
+    
     /**
      * Get the cacheMissRead value.
      */
     unsigned int getCacheMissRead()
     {
+        std::lock_guard<std::mutex> lock(myMutex);
         return cacheMissRead;
     }
     
@@ -210,14 +375,55 @@ public:
      */
     unsigned int getCacheMissWrite()
     {
+        std::lock_guard<std::mutex> lock(myMutex);
         return cacheMissWrite;
     }
     
+    /**
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead()
+    {
+        std::lock_guard<std::mutex> lock(myMutex);
+        unsigned int hits = cacheHitRead;
+        for (std::size_t i = 0; i < NbShards; i++)
+        {
+          std::lock_guard<std::mutex> shardLock(myShards[i].mutex);
+          hits += myShards[i].cacheHitRead;
+        }
+        return hits;
+    }
+    
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite()
+    {
+        std::lock_guard<std::mutex> lock(myMutex);
+        unsigned int hits = cacheHitWrite;
+        for (std::size_t i = 0; i < NbShards; i++)
+        {
+          std::lock_guard<std::mutex> shardLock(myShards[i].mutex);
+          hits += myShards[i].cacheHitWrite;
+        }
+        return hits;
+    }
+    
+    /**
+     * Get the cacheEviction value (number of detached pages).
+     */
+    unsigned int getCacheEviction()
+    {
+        std::lock_guard<std::mutex> lock(myMutex);
+        return cacheEviction;
+    }
+    
     /**
      * Inc the cacheMissRead value.
      */
     void incCacheMissRead()
     {
+        std::lock_guard<std::mutex> lock(myMutex);
         cacheMissRead++;
     }
     
@@ -226,18 +432,31 @@ public:
      */
     void incCacheMissWrite()
     {
+        std::lock_guard<std::mutex> lock(myMutex);
         cacheMissWrite++;
     }
     
     /**
-     * Clear the cache and reset the cache misses
+     * Clear the cache and reset the cache hits, misses and evictions
      */
     void clearCacheAndResetCacheMisses()
     {
+      std::lock_guard<std::mutex> lock(myMutex);
       myReadPolicy->clearCache();
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      cacheEviction = 0;
+      
+      forgetPagesLocked();
+      for (std::size_t i = 0; i < NbShards; i++)
+      {
+        std::lock_guard<std::mutex> shardLock(myShards[i].mutex);
+        myShards[i].cacheHitRead = 0;
+        myShards[i].cacheHitWrite = 0;
+      }
     }
 
     // ------------------------- Protected Datas ------------------------------
@@ -262,9 +481,148 @@ private:
     /// cache miss values
     unsigned int cacheMissRead;
     unsigned int cacheMissWrite;
+    
+    /// cache hit values
+    mutable unsigned int cacheHitRead;
+    unsigned int cacheHitWrite;
+    
+    /// number of detached pages
+    unsigned int cacheEviction;
+    
+    /// Pins of a page, and whether the read policy has detached it
+    struct Pin
+    {
+      unsigned int count;
+      bool detached;
+    };
+    
+    /// State shared by the caches of a read policy (guarded by its mutex)
+    struct Group
+    {
+      std::mutex mutex;
+      /// Caches of the read policy
+      std::vector<Self *> caches;
+      /// Pages put in cache and not detached yet
+      std::set<ImageContainer *> pages;
+      /// Pins of the pinned pages
+      std::map<ImageContainer *, Pin> pins;
+    };
+    
+    /// Group of the caches sharing the read policy
+    std::shared_ptr<Group> myGroup;
+    
+    /// Mutex of the group, guarding the policies, the counters, the keys and the pins
+    std::mutex & myMutex;
+    
+    /// Number of pins taken through this cache and not released yet
+    unsigned int myNbPins;
+    
+    /**
+     * Mutex guarding the slots of the keys k such that k % NbShards is
+     * the index of the shard, and the hits counted without the cache
+     * mutex. Padded so that two shards do not share a cache line.
+     */
+    struct Shard
+    {
+      std::mutex mutex;
+      unsigned int cacheHitRead;
+      unsigned int cacheHitWrite;
+      char padding[64];
+    };
+    
+    /// Shards of the keyed accesses
+    Shard myShards[NbShards];
+    
+    /// Page of each key, NULL if not in cache (the slot of a key is guarded by its shard)
+    std::vector<ImageContainer *> mySlots;
+    
+    /// Key of the pages registered in a slot (guarded by the cache mutex)
+    std::map<const ImageContainer *, std::size_t> myKeys;
 
     // ------------------------- Internals ------------------------------------
 private:
+    
+    /**
+     * Detach pages according to the read policy, then put the domain
+     * aDomain in cache. The mutex must be held.
+     * 
+     * @param aDomain the domain.
+     */
+    void updateLocked(const Domain &aDomain);
+    
+    /**
+     * Registers the page aPage in the slot of the key aKey. The mutex
+     * must be held.
+     *
+     * @param aPage a page in cache.
+     * @param aKey the key of the page.
+     */
+    void attachLocked(ImageContainer * aPage, std::size_t aKey);
+    
+    /**
+     * Locks the shards of the slots of aPage in the caches of the
+     * group, so that it can be written. The mutex must be held.
+     *
+     * @param aPage a page in cache.
+     * @return the locks on the shards, empty if aPage is not registered in a slot.
+     */
+    std::vector< std::unique_lock<std::mutex> > lockPageLocked(const ImageContainer * aPage);
+    
+    /**
+     * Removes the page aPage from the slots of the caches of the
+     * group, so that their readers do not see it once detached. The
+     * mutex must be held.
+     *
+     * @param aPage a page in cache.
+     */
+    void forgetPageLocked(const ImageContainer * aPage);
+    
+    /**
+     * Empties the slots of the caches of the group and forgets their
+     * pages, after the read policy has been cleared. The mutex must
+     * be held.
+     */
+    void forgetPagesLocked();
+    
+    /**
+     * @return the groups of the caches, by read policy (guarded by registryMutex()).
+     */
+    static std::map< const ReadPolicy *, std::shared_ptr<Group> > & groups()
+    {
+      static std::map< const ReadPolicy *, std::shared_ptr<Group> > theGroups;
+      return theGroups;
+    }
+    
+    /**
+     * @return the mutex guarding the groups.
+     */
+    static std::mutex & registryMutex()
+    {
+      static std::mutex theMutex;
+      return theMutex;
+    }
+    
+    /**
+     * @param aReadPolicy a read policy.
+     * @return the group of the caches of aReadPolicy, created if needed.
+     */
+    static std::shared_ptr<Group> joinGroup(const ReadPolicy * aReadPolicy)
+    {
+      std::lock_guard<std::mutex> registryLock(registryMutex());
+      std::shared_ptr<Group> & group = groups()[aReadPolicy];
+      if (!group)
+        group = std::make_shared<Group>();
+      return group;
+    }
+    
+    /**
+     * Releases a pin of aPage taken by pinPageOrUpdate, detaching
+     * aPage if it was the last pin and the read policy has detached
+     * it meanwhile.
+     *
+     * @param aPage a pinned page.
+     */
+    void unpinPage(ImageContainer * aPage);
 
 }; // end of class ImageCache
 
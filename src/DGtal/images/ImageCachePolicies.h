@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <list>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -266,6 +268,346 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU' read policy cache with a memory budget.
+ * 
+ * The cache keeps track of all the pages in memory in a list ordered by
+ * their last access, the most recently used page in front.
+ * When room is needed, the page at the back of the list (the least recently used page) is selected.
+ * 
+ * The size of the cache is given in bytes: a page of domain d costs
+ * d.size() * sizeof(Value) bytes, and pages are detached until the
+ * largest page seen so far fits in the budget. The budget should
+ * hold at least one page: a page is always loaded in an empty cache.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aBytesMax the memory budget of the cache, in bytes.
+     */
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, std::size_t aBytesMax):
+       myBytesMax(aBytesMax), myBytes(0), myPageBytesMax(0), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+private:
+    
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+    
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+    /**
+     * @return the number of bytes of the pages in the cache.
+     */
+    std::size_t bytes() const
+    {
+      return myBytes;
+    }
+    
+    /**
+     * @param aDomain the domain of a page.
+     * @return the number of bytes of a page of domain aDomain.
+     */
+    static std::size_t pageBytes(const Domain & aDomain)
+    {
+      return static_cast<std::size_t>( aDomain.size() ) * sizeof( Value );
+    }
+    
+protected:
+    
+    /// Alias on the images cache, the most recently used first
+    std::list <ImageContainer *> myLRUCacheImages;
+    
+    /// Memory budget of the cache (in bytes)
+    std::size_t myBytesMax;
+    
+    /// Bytes of the pages in the cache
+    std::size_t myBytes;
+    
+    /// Bytes of the largest page requested so far
+    std::size_t myPageBytesMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyARC
+/**
+ * Description of template class 'ImageCacheReadPolicyARC' <p>
+ * \brief Aim: implements an 'ARC' (Adaptive Replacement Cache) read policy cache with a memory budget.
+ * 
+ * The pages in memory are split in two LRU lists: T1 holds the pages
+ * accessed once, T2 the pages accessed again since they were loaded.
+ * The domains of the pages recently detached from T1 and T2 are
+ * remembered in two ghost lists B1 and B2. Requesting a page again
+ * whose domain is in B1 (resp. B2) increases (resp. decreases) the
+ * target size of T1, so that the cache adapts itself between recency
+ * and frequency: a scan through many tiles does not flush the tiles
+ * used repeatedly. When room is needed, the least recently used page
+ * of T1 is selected if T1 is larger than its target, the one of T2
+ * otherwise.
+ * 
+ * A page is accessed again when it is requested after another page:
+ * consecutive accesses to the same page (e.g. a scan inside a tile)
+ * count as one.
+ * 
+ * As for ImageCacheReadPolicyLRU, the size of the cache is given in
+ * bytes: a page of domain d costs d.size() * sizeof(Value) bytes.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyARC
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aBytesMax the memory budget of the cache, in bytes.
+     */
+    ImageCacheReadPolicyARC(Alias<ImageFactory> anImageFactory, std::size_t aBytesMax):
+       myT1Bytes(0), myT2Bytes(0), myB1Bytes(0), myB2Bytes(0), myTarget(0),
+       myBytesMax(aBytesMax), myPageBytesMax(0), myLastPage(NULL), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyARC() {}
+    
+private:
+    
+    ImageCacheReadPolicyARC( const ImageCacheReadPolicyARC & other );
+    
+    ImageCacheReadPolicyARC & operator=( const ImageCacheReadPolicyARC & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+    /**
+     * @return the number of bytes of the pages in the cache.
+     */
+    std::size_t bytes() const
+    {
+      return myT1Bytes + myT2Bytes;
+    }
+    
+    /**
+     * @return the current target size of T1 (in bytes).
+     */
+    std::size_t target() const
+    {
+      return myTarget;
+    }
+    
+    /**
+     * @param aDomain the domain of a page.
+     * @return the number of bytes of a page of domain aDomain.
+     */
+    static std::size_t pageBytes(const Domain & aDomain)
+    {
+      return static_cast<std::size_t>( aDomain.size() ) * sizeof( Value );
+    }
+    
+protected:
+    
+    typedef std::list <ImageContainer *> Pages;
+    typedef std::list <Domain> Ghosts;
+    
+    /**
+     * Moves an accessed page at the front of T2.
+     *
+     * @param aPages the list (T1 or T2) containing the page.
+     * @param it the page in aPages.
+     * @param inT1 'true' if aPages is T1.
+     * @return the page.
+     */
+    ImageContainer * access(Pages & aPages, typename Pages::iterator it, bool inT1);
+    
+    /**
+     * Finds the domain aDomain in a ghost list and removes it.
+     *
+     * @param aGhosts the ghost list (B1 or B2).
+     * @param aGhostsBytes the bytes of aGhosts, updated.
+     * @param aDomain the domain.
+     * @return 'true' if aDomain was in aGhosts.
+     */
+    static bool forget(Ghosts & aGhosts, std::size_t & aGhostsBytes, const Domain & aDomain);
+    
+    /**
+     * Bounds the ghost lists: |T1|+|B1| and |T1|+|T2|+|B1|+|B2| are
+     * respectively bounded by the budget and twice the budget.
+     */
+    void trimGhosts();
+    
+    /// Pages accessed once (T1) and at least twice (T2), the most recently used first
+    Pages myT1, myT2;
+    
+    /// Domains of the pages recently detached from T1 (B1) and T2 (B2)
+    Ghosts myB1, myB2;
+    
+    /// Bytes of the lists
+    std::size_t myT1Bytes, myT2Bytes, myB1Bytes, myB2Bytes;
+    
+    /// Target size of T1 (in bytes)
+    std::size_t myTarget;
+    
+    /// Memory budget of the cache (in bytes)
+    std::size_t myBytesMax;
+    
+    /// Bytes of the largest page requested so far
+    std::size_t myPageBytesMax;
+    
+    /// Last accessed page
+    ImageContainer * myLastPage;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyARC
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
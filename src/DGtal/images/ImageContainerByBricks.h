@@ -0,0 +1,397 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByBricks.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBricks
+  /**
+   * Description of template class 'ImageContainerByBricks' <p>
+   *
+   * Aim: Model of CImage storing the values in small cubic bricks of
+   * 2^TLogBrickSize points per side. The values of a brick are
+   * contiguous (in lexicographic order inside the brick) and the
+   * bricks are stored in Z-order (Morton order of the brick
+   * coordinates). Hence, the neighborhood of a point mostly lies in
+   * the same brick, or in bricks stored close to it, which makes
+   * stencil computations (neighborhood sums, filters, distance
+   * transforms) more cache-friendly than with a lexicographic
+   * container (ImageContainerBySTLVector) on large 3D images.
+   *
+   * The storage index of a point is computed in constant time from
+   * per-coordinate tables (see linearized()). Inside a brick, the
+   * neighbor of a point along dimension k is at offset +/- stride(k)
+   * of its storage index: when isInsideBrick() holds, a whole
+   * neighborhood can be read through operator[] without computing any
+   * other index.
+   *
+   * As a model of CImage, this class provides two ways of accessing values:
+   * - through the range of points returned by the domain() method
+   * combined with the operator() that takes a point and returns its associated value.
+   * - through the range of values returned by the range() method,
+   * which iterates over the values in the order of the domain points,
+   * as any other image container.
+   *
+   * The bricks can also be processed independently, e.g. in parallel:
+   * @code
+   * #pragma omp parallel for schedule(dynamic)
+   * for ( std::ptrdiff_t i = 0; i < (std::ptrdiff_t) image.nbBricks(); ++i )
+   *   for ( auto p : image.brickDomain( i ) ) ...
+   * @endcode
+   *
+   * The bricks on the upper border of the domain are partially
+   * covered by the domain: the values of the points outside the domain
+   * are stored but never read.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel.
+   * @tparam TLogBrickSize the base 2 logarithm of the brick side (default 3, i.e. 8^d bricks).
+   *
+   * @see testImageContainerByBricks.cpp
+   * @see benchmarkImageContainerByBricks.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize = 3>
+  class ImageContainerByBricks
+  {
+
+  public:
+
+    typedef ImageContainerByBricks<TDomain, TValue, TLogBrickSize> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// bricks should fit in memory
+    BOOST_STATIC_ASSERT ( ( TLogBrickSize * Domain::Space::dimension < 8 * sizeof( Size ) - 1 ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    typedef TValue Value;
+
+    /// Ranges and iterators
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Side and number of points of a brick
+    BOOST_STATIC_CONSTANT( Size, brickSide = Size( 1 ) << TLogBrickSize );
+    BOOST_STATIC_CONSTANT( Size, brickVolume = Size( 1 ) << ( TLogBrickSize * Domain::Space::dimension ) );
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    /// Index contributions of a coordinate
+    struct Contribution
+    {
+      /// Contribution to the Morton code of the brick
+      Size code;
+      /// Contribution to the index inside the brick
+      Size offset;
+    };
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Index contributions of the coordinates, for each dimension in turn
+    std::vector<Contribution> myContributions;
+
+    ///Index in myContributions of the contribution of coordinate 0, for each dimension
+    std::array<std::ptrdiff_t, dimension> myStarts;
+
+    ///Rank of each brick in the storage, indexed by Morton code
+    std::vector<Size> myRanks;
+
+    ///Lower bound of each brick, in storage order
+    std::vector<Point> myBrickLowerBounds;
+
+    ///Values
+    std::vector<Value> myValues;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a domain.
+     *
+     * @param aDomain the image domain.
+     * @param aValue the initial value of the points.
+     */
+    ImageContainerByBricks( const Domain &aDomain, const Value &aValue = Value() );
+
+    /**
+     * Destructor.
+     *
+     */
+    ~ImageContainerByBricks() {}
+
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point &aPoint ) const
+    {
+      return myValues[ linearized( aPoint ) ];
+    }
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point &aPoint, const Value &aValue )
+    {
+      myValues[ linearized( aPoint ) ] = aValue;
+    }
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const
+    {
+      return myDomain;
+    }
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the values of the image, in the
+     * order of the domain points.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream &out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const
+    {
+      return myDomain.isValid();
+    }
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////// Storage indices //////////////////
+
+    /**
+     * Storage index of a point: the rank of its brick times
+     * brickVolume, plus its index inside the brick.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the index of @a aPoint in the storage.
+     */
+    Size linearized( const Point &aPoint ) const
+    {
+      const Contribution * c = myContributions.data();
+      Size code = 0, offset = 0;
+      for ( Dimension k = 0; k < dimension; ++k )
+        {
+          const Contribution & ck = c[ myStarts[ k ] + aPoint[ k ] ];
+          code += ck.code;
+          offset += ck.offset;
+        }
+      return myRanks[ code ] * brickVolume + offset;
+    }
+
+    /**
+     * @param aIndex a storage index (see linearized()).
+     * @return a reference to the value at this index.
+     */
+    const Value & operator[]( Size aIndex ) const
+    {
+      return myValues[ aIndex ];
+    }
+
+    /**
+     * @param aIndex a storage index (see linearized()).
+     * @return a reference to the value at this index.
+     */
+    Value & operator[]( Size aIndex )
+    {
+      return myValues[ aIndex ];
+    }
+
+    /**
+     * @param k a dimension.
+     * @return the difference between the storage indices of two
+     * neighbors along dimension @a k in the same brick.
+     */
+    static Size stride( Dimension k )
+    {
+      return Size( 1 ) << ( TLogBrickSize * k );
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @param aRadius a radius.
+     * @return 'true' if all the points at L-infinity distance at most
+     * @a aRadius of @a aPoint are in the domain and in the brick of
+     * @a aPoint, i.e. can be reached from linearized( aPoint ) with
+     * stride offsets.
+     */
+    bool isInsideBrick( const Point &aPoint, Integer aRadius = 1 ) const;
+
+    /////////////////// Bricks //////////////////
+
+    /**
+     * @return the number of bricks.
+     */
+    Size nbBricks() const
+    {
+      return static_cast<Size>( myBrickLowerBounds.size() );
+    }
+
+    /**
+     * @param aBrick a brick rank, in [0, nbBricks()).
+     * @return the domain of the brick, clipped to the image domain.
+     */
+    Domain brickDomain( Size aBrick ) const;
+
+    /**
+     * @param aBrick a brick rank, in [0, nbBricks()).
+     * @return a pointer to the brickVolume values of the brick, in
+     * lexicographic order of the points inside the brick.
+     */
+    const Value * brickValues( Size aBrick ) const
+    {
+      return myValues.data() + aBrick * brickVolume;
+    }
+
+    /**
+     * @param aBrick a brick rank, in [0, nbBricks()).
+     * @return a pointer to the brickVolume values of the brick, in
+     * lexicographic order of the points inside the brick.
+     */
+    Value * brickValues( Size aBrick )
+    {
+      return myValues.data() + aBrick * brickVolume;
+    }
+
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TLogBrickSize>
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain, TValue, TLogBrickSize> & object )
+  {
+    object.selfDisplay ( out );
+    return out;
+  }
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
@@ -116,6 +116,18 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * Instead of calling setValue() on each point, the tree can be
+   * built in a single bottom-up traversal from a dense image
+   * (assignFromImage()) or from a range of (key, value) pairs sorted
+   * by increasing keys (assignFromSortedRange()), e.g. computed with
+   * getKey() or Morton::keyFromCoordinates().
+   *
+   * The read methods (get(), upwardGet(), reverseGet(), operator())
+   * do not modify the container: once built, it may be read
+   * concurrently from several threads, as long as no thread modifies
+   * it (setValue(), assignFromImage(), assignFromSortedRange()) at the
+   * same time.
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @tparam THashKey  type to store Morton keys
@@ -361,6 +373,46 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Replaces the content of the container by the values of an
+     * image. The tree is built bottom-up in a single traversal, each
+     * maximal block of equal values becoming a leaf as with
+     * setValue(), in linear time in the number of visited nodes.
+     *
+     * The points of the tree span outside the image domain get the
+     * value @a aDefaultValue.
+     *
+     * @tparam TConstImage a model of CConstImage whose values are
+     * convertible to Value.
+     * @param anImage the image (the tree keys are computed relatively
+     * to the origin of the container, see getKey()).
+     * @param aDefaultValue the value of the points outside the image domain.
+     */
+    template <typename TConstImage>
+    void assignFromImage( const TConstImage & anImage,
+                          const Value aDefaultValue = NumberTraits<Value>::ZERO );
+
+    /**
+     * Replaces the content of the container by a range of (key, value)
+     * pairs, the keys being leaf keys (i.e. at maximal depth, see
+     * getKey()) sorted in increasing order. The tree is built
+     * bottom-up in a single traversal, in linear time in the number of
+     * pairs times the tree depth.
+     *
+     * The points whose key is not in the range get the value
+     * @a aDefaultValue.
+     *
+     * @tparam TInputIterator an input iterator on pairs (such as
+     * std::pair<HashKey,Value>) with members @a first (the key) and
+     * @a second (the value).
+     * @param itb begin iterator on the pairs.
+     * @param ite end iterator on the pairs.
+     * @param aDefaultValue the value of the points without key.
+     */
+    template <typename TInputIterator>
+    void assignFromSortedRange( TInputIterator itb, TInputIterator ite,
+                                const Value aDefaultValue = NumberTraits<Value>::ZERO );
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -744,6 +796,67 @@ namespace DGtal
      */
     Value blendChildren(HashKey key) const;
 
+    /**
+     * Removes all the nodes of the tree.
+     */
+    void clear();
+
+    /**
+     * Inserts a node without checking whether the key is already in
+     * the tree (used when building the tree bottom-up).
+     * @param object a object (value)
+     * @param key a hashtree key
+     */
+    void insertNode(const Value object, const HashKey key);
+
+    /**
+     * Ends the bottom-up construction of a node: if its children are
+     * leaves with the same value, the node becomes a leaf with this
+     * value, otherwise the children leaves are inserted.
+     *
+     * @param key the key of the node.
+     * @param uniform for each child, 'true' if it is a leaf.
+     * @param values for each child leaf, its value.
+     * @param[out] aValue the value of the node if it becomes a leaf.
+     * @return 'true' if the node becomes a leaf.
+     */
+    bool mergeChildren(const HashKey key, const bool * uniform,
+                       const Value * values, Value & aValue);
+
+    /**
+     * Recursively builds the sub-tree of a node from an image (see
+     * assignFromImage()).
+     *
+     * @param anImage the image.
+     * @param key the key of the node.
+     * @param depth the depth of the node.
+     * @param aLower the lowest point covered by the node.
+     * @param aDefaultValue the value of the points outside the image domain.
+     * @param[out] aValue the value of the node if it is a leaf.
+     * @return 'true' if the node is a leaf (not inserted yet).
+     */
+    template <typename TConstImage>
+    bool buildFromImage(const TConstImage & anImage, const HashKey key,
+                        const unsigned int depth, const Point & aLower,
+                        const Value aDefaultValue, Value & aValue);
+
+    /**
+     * Recursively builds the sub-tree of a node from sorted (key,
+     * value) pairs (see assignFromSortedRange()).
+     *
+     * @param it the current pair, moved past the pairs of the sub-tree.
+     * @param ite end iterator on the pairs.
+     * @param key the key of the node.
+     * @param depth the depth of the node.
+     * @param aDefaultValue the value of the points without key.
+     * @param[out] aValue the value of the node if it is a leaf.
+     * @return 'true' if the node is a leaf (not inserted yet).
+     */
+    template <typename TInputIterator>
+    bool buildFromSortedRange(TInputIterator & it, const TInputIterator & ite,
+                              const HashKey key, const unsigned int depth,
+                              const Value aDefaultValue, Value & aValue);
+
 
     //----------------------- internal data --------------------------------
   protected:
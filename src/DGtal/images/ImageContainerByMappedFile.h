@@ -0,0 +1,494 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <memory>
+#include <cstring>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // class MappedFileRegion
+    /**
+     * Description of class 'MappedFileRegion' <p>
+     *
+     * Aim: RAII handle on a contiguous region of a file mapped into
+     * memory. Pages are only read from the disk when they are first
+     * accessed, and the kernel may drop clean pages under memory
+     * pressure, so that files larger than the main memory can be
+     * scanned.
+     *
+     * The region is either read-only (writing to it is an error) or
+     * copy-on-write (modified pages are private to the process and
+     * never written back to the file).
+     *
+     * On systems without POSIX mmap, the region is read into memory
+     * instead. The region start is not aligned in general (e.g. after
+     * a text header).
+     */
+    class MappedFileRegion
+    {
+    public:
+      /// Access mode of the mapping.
+      enum Mode { READ_ONLY, COPY_ON_WRITE };
+
+      /// Access patterns hints, forwarded to madvise.
+      enum Advice { NORMAL, SEQUENTIAL, RANDOM, WILL_NEED, DONT_NEED };
+
+      /**
+       * Maps @a length bytes of file @a filename starting at byte @a offset.
+       *
+       * @param filename the file name.
+       * @param offset the position of the region in the file.
+       * @param length the length of the region in bytes.
+       * @param mode the access mode.
+       *
+       * @throw IOException if the file cannot be opened, is too
+       * short, or cannot be mapped.
+       */
+      MappedFileRegion( const std::string & filename,
+                        std::size_t offset, std::size_t length,
+                        Mode mode );
+
+      /**
+       * Copies @a length bytes from @a data into a region held in
+       * memory.
+       *
+       * @param data the bytes to copy.
+       * @param length the number of bytes.
+       * @param mode the access mode.
+       *
+       * @throw std::bad_alloc if the memory cannot be allocated.
+       */
+      MappedFileRegion( const char * data, std::size_t length, Mode mode );
+
+      /// Unmaps the region.
+      ~MappedFileRegion();
+
+      /// @return the first byte of the region.
+      char * data() const;
+
+      /// @return the length of the region in bytes.
+      std::size_t size() const;
+
+      /// @return the access mode.
+      Mode mode() const;
+
+      /// @return 'true' if the region is mapped from the file, 'false'
+      /// if it has been read into memory.
+      bool isMapped() const;
+
+      /**
+       * Gives an access pattern hint for the bytes [begin,begin+length)
+       * of the region. This is a no-op when the region is not mapped,
+       * and DONT_NEED is ignored in COPY_ON_WRITE mode.
+       *
+       * @param advice the expected access pattern.
+       * @param begin the first byte concerned.
+       * @param length the number of bytes concerned.
+       */
+      void advise( Advice advice, std::size_t begin, std::size_t length ) const;
+
+    private:
+      MappedFileRegion( const MappedFileRegion & other ) = delete;
+      MappedFileRegion & operator=( const MappedFileRegion & other ) = delete;
+
+      /// Reads the region into memory (fallback when mapping is not possible).
+      void readRegion( const std::string & filename, std::size_t offset );
+
+      /// Start of the mapping (page aligned), or of the memory buffer.
+      char * myBase;
+      /// Number of bytes mapped from myBase.
+      std::size_t myMappedSize;
+      /// Start of the region.
+      char * myData;
+      /// Length of the region.
+      std::size_t mySize;
+      /// Access mode.
+      Mode myMode;
+      /// True when myBase comes from mmap.
+      bool myIsMapped;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class UnalignedValueIterator
+    /**
+     * Description of template class 'UnalignedValueIterator' <p>
+     *
+     * Aim: random access iterator on values stored contiguously at
+     * an address that may not be aligned for them. Values are loaded
+     * with memcpy, which compiles to plain loads on the platforms
+     * allowing unaligned accesses.
+     *
+     * @tparam TValue the type of the values.
+     */
+    template <typename TValue>
+    class UnalignedValueIterator
+      : public boost::iterator_facade< UnalignedValueIterator<TValue>, const TValue,
+                                       std::random_access_iterator_tag, TValue >
+    {
+    public:
+      UnalignedValueIterator() : myPtr( NULL ) {}
+
+      /// @param aPtr the first byte of a value.
+      explicit UnalignedValueIterator( const char * aPtr ) : myPtr( aPtr ) {}
+
+      /// @param aPtr an aligned value.
+      UnalignedValueIterator( const TValue * aPtr )
+        : myPtr( reinterpret_cast<const char*>( aPtr ) ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+
+      TValue dereference() const
+      {
+        TValue value;
+        std::memcpy( &value, myPtr, sizeof( TValue ) );
+        return value;
+      }
+      bool equal( const UnalignedValueIterator & other ) const { return myPtr == other.myPtr; }
+      void increment() { myPtr += sizeof( TValue ); }
+      void decrement() { myPtr -= sizeof( TValue ); }
+      void advance( std::ptrdiff_t n ) { myPtr += n * static_cast<std::ptrdiff_t>( sizeof( TValue ) ); }
+      std::ptrdiff_t distance_to( const UnalignedValueIterator & other ) const
+      {
+        return ( other.myPtr - myPtr ) / static_cast<std::ptrdiff_t>( sizeof( TValue ) );
+      }
+
+      /// First byte of the current value.
+      const char * myPtr;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   *
+   * Aim: Model of CImage whose values are those stored in a file,
+   * mapped into memory instead of being read. The values are
+   * stored in little-endian order, with the same linearization as
+   * ImageContainerBySTLVector (first coordinate varying fastest). This is
+   * the layout of raw files and of the uncompressed payload of vol
+   * (Version 2) and longvol files, see RawReader::mapRaw,
+   * VolReader::mapVol and LongvolReader::mapLongvol.
+   *
+   * Only the pages actually visited are read from the disk, hence the
+   * image can be used by DistanceTransformation, SetFromImage or the
+   * integral invariant estimators (through a point predicate) on
+   * volumes larger than the main memory.
+   *
+   * The image is read-only by default: setValue() and range() then
+   * throw an IOException. In COPY_ON_WRITE mode, values can be
+   * modified but changes are never written back to the file.
+   *
+   * Copies of an ImageContainerByMappedFile share the same mapping
+   * until one of them is modified: the modified image first copies
+   * the values into a private memory buffer, so that copies keep
+   * value semantics. Iterators given by range() are only valid until
+   * the image is copied.
+   *
+   * The values need not be aligned in the file (e.g. longvol files,
+   * whose header is text): they are then loaded with memcpy. Only
+   * range() needs aligned values, and copies them into memory if
+   * they are not.
+   *
+   * @code
+   * typedef ImageContainerByMappedFile< Z3i::Domain, unsigned char > Image;
+   * Image image = VolReader< Image >::mapVol( "big.vol" );
+   * image.advise( Image::SEQUENTIAL );   // for a single scan of the values
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the values, stored as is in the file.
+   *
+   * @see testImageContainerByMappedFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    typedef ImageContainerByMappedFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    typedef TValue Value;
+
+    typedef detail::MappedFileRegion::Mode Mode;
+    static const Mode READ_ONLY = detail::MappedFileRegion::READ_ONLY;
+    static const Mode COPY_ON_WRITE = detail::MappedFileRegion::COPY_ON_WRITE;
+
+    typedef detail::MappedFileRegion::Advice Advice;
+    static const Advice NORMAL = detail::MappedFileRegion::NORMAL;
+    static const Advice SEQUENTIAL = detail::MappedFileRegion::SEQUENTIAL;
+    static const Advice RANDOM = detail::MappedFileRegion::RANDOM;
+    static const Advice WILL_NEED = detail::MappedFileRegion::WILL_NEED;
+    static const Advice DONT_NEED = detail::MappedFileRegion::DONT_NEED;
+
+    /////////////////////////// Iterators ////////////////////
+    typedef Value * Iterator;
+    typedef detail::UnalignedValueIterator<Value> ConstIterator;
+    typedef std::ptrdiff_t Difference;
+
+    /////////////////////////// Ranges  /////////////////////
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator,DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator,Iterator,DistanceFunctorFromPoint<Self> > Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor. Maps the values of the points of @a aDomain, stored
+     * in file @a filename from byte @a offset.
+     *
+     * @param filename the file name.
+     * @param aDomain the image domain.
+     * @param offset the position of the first value in the file (e.g. the header size).
+     * @param mode either READ_ONLY or COPY_ON_WRITE.
+     *
+     * @throw IOException if the file cannot be mapped, if it is too
+     * short, or if values are multi-bytes and the host is big-endian.
+     */
+    ImageContainerByMappedFile( const std::string & filename,
+                                const Domain & aDomain,
+                                std::size_t offset = 0,
+                                Mode mode = READ_ONLY );
+
+    /**
+     * Destructor. The file is unmapped when the last copy is destroyed.
+     */
+    ~ImageContainerByMappedFile();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     *
+     * @throw IOException if the image is READ_ONLY.
+     */
+    void setValue ( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the access mode of the image.
+     */
+    Mode mode() const;
+
+    /**
+     * @return 'true' if values are read lazily from the file, 'false'
+     * if the mapping was not possible and values were read into memory,
+     * or if they were copied by range().
+     */
+    bool isMapped() const;
+
+    /**
+     * Gives an access pattern hint for the whole image, e.g.
+     * SEQUENTIAL before a single scan of the values, RANDOM before
+     * accesses with poor locality, or DONT_NEED to release the pages
+     * already read.
+     *
+     * @param advice the expected access pattern.
+     */
+    void advise( Advice advice ) const;
+
+    /**
+     * Gives an access pattern hint for the values of the points in
+     * the range [@a first, @a last] of the linearization, e.g. the
+     * slices about to be processed.
+     *
+     * @param advice the expected access pattern.
+     * @param first a point of the domain.
+     * @param last a point of the domain, after @a first in the linearization.
+     */
+    void advise( Advice advice, const Point & first, const Point & last ) const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan and modify the values of image.
+     * @throw IOException if the image is READ_ONLY.
+     */
+    Range range();
+
+    /**
+     * Linearized a point and return the vector position.
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the container
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////// Internals //////////////////
+
+  private:
+
+    /**
+     * @param aligned when 'true', the values are also copied into
+     * memory if they are not aligned.
+     * @return the first byte of the values, after making them private
+     * to this image if they were shared with a copy.
+     * @throw IOException if the image is READ_ONLY.
+     */
+    char * writableValues( bool aligned );
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    /// Mapped file region, shared by copies until one is modified.
+    std::shared_ptr<detail::MappedFileRegion> myRegion;
+
+    /// First byte of the first value of the image (not aligned in general).
+    char * myValues;
+
+    /// Number of values.
+    Size mySize;
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -0,0 +1,914 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageExpression.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageExpression.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageExpression_RECURSES)
+#error Recursive header files inclusion detected in ImageExpression.h
+#else // defined(ImageExpression_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageExpression_RECURSES
+
+#if !defined ImageExpression_h
+/** Prevents repeated inclusion of headers. */
+#define ImageExpression_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Image expressions
+  /**
+   * @brief Aim: lazy element-wise expressions on images (expression
+   * templates).
+   *
+   * An image expression is built from images with
+   * imageExpression(), then combined with the arithmetic, comparison
+   * and logical operators, with scalars, and with the functions
+   * mapValues(), castValues() and select(). Nothing is computed when
+   * an expression is built: the expression is a model of CConstImage
+   * whose value at a point is computed from the values of the images
+   * at this point, and it is evaluated as a whole by
+   * imageFromExpression() (or evaluate()) and by the reductions
+   * sumValues(), minValue(), maxValue() and countValues().
+   *
+   * When all the images of the expression are
+   * ImageContainerBySTLVector (or ConstImageAdapter on such an image
+   * with the same domain and an identity domain functor) on the
+   * domain of the evaluation, the expression is evaluated by a single
+   * loop on the storage indices, that compilers vectorize for
+   * simple operations, and that is run in parallel if OpenMP is
+   * enabled. Otherwise, it is evaluated point by point along the
+   * domain.
+   *
+   * @code
+   * ImageContainerBySTLVector<Z3i::Domain, float> result( a.domain() );
+   * imageFromExpression( result, select( imageExpression( mask ) > 0,
+   *                                      0.5f * ( imageExpression( a ) + imageExpression( b ) ),
+   *                                      0.0f ) );
+   * const std::size_t n = countValues( imageExpression( a ) > 128 );
+   * @endcode
+   *
+   * @note the images of an expression are aliased: they should live
+   * as long as the expression.
+   *
+   * @see testImageExpression.cpp
+   * @see benchmarkImageExpression.cpp
+   */
+  template <typename TExpression>
+  struct ImageExpression
+  {
+    /**
+     * @return the expression as its actual type.
+     */
+    const TExpression & derived() const
+    {
+      return static_cast<const TExpression &>( *this );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageLinearAccess
+  /**
+   * Description of template class 'ImageLinearAccess' <p>
+   * \brief Aim: tells whether the values of an image can be read by
+   * storage index, in the order of its (hyper-rectangular) domain.
+   *
+   * Models provide a static constant @a value, a type Accessor
+   * returning the value at a storage index, a static method
+   * accessor(image) and a static method isLinearOver(image, domain)
+   * telling whether the storage indices of the image are the ones of
+   * the domain.
+   *
+   * @tparam TImage a model of CConstImage.
+   */
+  template <typename TImage>
+  struct ImageLinearAccess
+  {
+    BOOST_STATIC_CONSTANT( bool, value = false );
+
+    /// No linear access
+    struct Accessor {};
+
+    static Accessor accessor( const TImage & )
+    {
+      return Accessor();
+    }
+
+    static bool isLinearOver( const TImage &, const typename TImage::Domain & )
+    {
+      return false;
+    }
+  };
+
+  /**
+   * Linear access to an ImageContainerBySTLVector.
+   */
+  template <typename TSpace, typename TValue>
+  struct ImageLinearAccess< ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue > >
+  {
+    typedef ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue > Image;
+
+    BOOST_STATIC_CONSTANT( bool, value = true );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      typename Image::const_iterator myValues;
+
+      TValue operator()( const std::size_t anIndex ) const
+      {
+        return myValues[ anIndex ];
+      }
+    };
+
+    static Accessor accessor( const Image & anImage )
+    {
+      Accessor accessor = { anImage.begin() };
+      return accessor;
+    }
+
+    static bool isLinearOver( const Image & anImage, const HyperRectDomain<TSpace> & aDomain )
+    {
+      return ( anImage.domain().lowerBound() == aDomain.lowerBound() )
+        && ( anImage.domain().upperBound() == aDomain.upperBound() );
+    }
+  };
+
+  /**
+   * Linear access to a ConstImageAdapter applying a value functor to
+   * an ImageContainerBySTLVector (on the same domain).
+   */
+  template <typename TSpace, typename TValue, typename TNewValue, typename TFunctorV>
+  struct ImageLinearAccess< ConstImageAdapter< ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue >,
+                                               HyperRectDomain<TSpace>, functors::Identity,
+                                               TNewValue, TFunctorV > >
+  {
+    typedef ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue > Image;
+    typedef ConstImageAdapter< Image, HyperRectDomain<TSpace>, functors::Identity,
+                               TNewValue, TFunctorV > Adapter;
+
+    BOOST_STATIC_CONSTANT( bool, value = true );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      typename ImageLinearAccess<Image>::Accessor myImage;
+      TFunctorV myFunctor;
+
+      TNewValue operator()( const std::size_t anIndex ) const
+      {
+        return myFunctor( myImage( anIndex ) );
+      }
+    };
+
+    static Accessor accessor( const Adapter & anAdapter )
+    {
+      Accessor accessor = { ImageLinearAccess<Image>::accessor( *anAdapter.getPointer() ),
+                            anAdapter.valueFunctor() };
+      return accessor;
+    }
+
+    static bool isLinearOver( const Adapter & anAdapter, const HyperRectDomain<TSpace> & aDomain )
+    {
+      return ( anAdapter.domain().lowerBound() == aDomain.lowerBound() )
+        && ( anAdapter.domain().upperBound() == aDomain.upperBound() )
+        && ImageLinearAccess<Image>::isLinearOver( *anAdapter.getPointer(), aDomain );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageTerminal
+  /**
+   * Description of template class 'ImageTerminal' <p>
+   * \brief Aim: leaf of an image expression, aliasing an image.
+   *
+   * @tparam TImage a model of CConstImage.
+   */
+  template <typename TImage>
+  class ImageTerminal : public ImageExpression< ImageTerminal<TImage> >
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CConstImage<TImage> ));
+
+  public:
+    typedef ImageTerminal<TImage> Self;
+    typedef typename TImage::Domain Domain;
+    typedef typename TImage::Point Point;
+    typedef typename TImage::Value Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef ImageLinearAccess<TImage> LinearAccess;
+    typedef typename LinearAccess::Accessor Accessor;
+
+    BOOST_STATIC_CONSTANT( bool, isLinear = LinearAccess::value );
+
+    /**
+     * Constructor.
+     * @param anImage the image (aliased).
+     */
+    explicit ImageTerminal( ConstAlias<TImage> anImage )
+      : myImage( &anImage )
+    {}
+
+    const Domain & domain() const
+    {
+      return myImage->domain();
+    }
+
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    Value operator()( const Point & aPoint ) const
+    {
+      return (*myImage)( aPoint );
+    }
+
+    /**
+     * @param aDomain a domain.
+     * @return 'true' if the values can be read by the storage indices of @a aDomain.
+     */
+    bool isLinearOver( const Domain & aDomain ) const
+    {
+      return LinearAccess::isLinearOver( *myImage, aDomain );
+    }
+
+    /**
+     * @return the accessor to the values by storage index.
+     */
+    Accessor accessor() const
+    {
+      return LinearAccess::accessor( *myImage );
+    }
+
+  private:
+    /// Alias on the image
+    const TImage * myImage;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class UnaryImageExpression
+  /**
+   * Description of template class 'UnaryImageExpression' <p>
+   * \brief Aim: image expression applying a functor to the values of
+   * an expression.
+   *
+   * @tparam TExpression a type of image expression.
+   * @tparam TFunctor a type of unary functor.
+   */
+  template <typename TExpression, typename TFunctor>
+  class UnaryImageExpression : public ImageExpression< UnaryImageExpression<TExpression, TFunctor> >
+  {
+  public:
+    typedef UnaryImageExpression<TExpression, TFunctor> Self;
+    typedef typename TExpression::Domain Domain;
+    typedef typename TExpression::Point Point;
+    typedef typename std::decay< decltype( std::declval<const TFunctor &>()
+                                           ( std::declval<typename TExpression::Value>() ) ) >::type Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isLinear = TExpression::isLinear );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      typename TExpression::Accessor myExpression;
+      TFunctor myFunctor;
+
+      Value operator()( const std::size_t anIndex ) const
+      {
+        return myFunctor( myExpression( anIndex ) );
+      }
+    };
+
+    UnaryImageExpression( const TExpression & anExpression, const TFunctor & aFunctor )
+      : myExpression( anExpression ), myFunctor( aFunctor )
+    {}
+
+    const Domain & domain() const
+    {
+      return myExpression.domain();
+    }
+
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    Value operator()( const Point & aPoint ) const
+    {
+      return myFunctor( myExpression( aPoint ) );
+    }
+
+    bool isLinearOver( const Domain & aDomain ) const
+    {
+      return myExpression.isLinearOver( aDomain );
+    }
+
+    Accessor accessor() const
+    {
+      Accessor accessor = { myExpression.accessor(), myFunctor };
+      return accessor;
+    }
+
+  private:
+    TExpression myExpression;
+    TFunctor myFunctor;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryImageExpression
+  /**
+   * Description of template class 'BinaryImageExpression' <p>
+   * \brief Aim: image expression combining the values of two
+   * expressions with a functor. Its domain is the domain of the
+   * first expression, which should be included in the domain of the
+   * second one.
+   *
+   * @tparam TLeft a type of image expression.
+   * @tparam TRight a type of image expression (on the same type of domain).
+   * @tparam TFunctor a type of binary functor.
+   */
+  template <typename TLeft, typename TRight, typename TFunctor>
+  class BinaryImageExpression : public ImageExpression< BinaryImageExpression<TLeft, TRight, TFunctor> >
+  {
+    BOOST_STATIC_ASSERT(( boost::is_same< typename TLeft::Domain, typename TRight::Domain >::value ));
+
+  public:
+    typedef BinaryImageExpression<TLeft, TRight, TFunctor> Self;
+    typedef typename TLeft::Domain Domain;
+    typedef typename TLeft::Point Point;
+    typedef typename std::decay< decltype( std::declval<const TFunctor &>()
+                                           ( std::declval<typename TLeft::Value>(),
+                                             std::declval<typename TRight::Value>() ) ) >::type Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isLinear = TLeft::isLinear && TRight::isLinear );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      typename TLeft::Accessor myLeft;
+      typename TRight::Accessor myRight;
+      TFunctor myFunctor;
+
+      Value operator()( const std::size_t anIndex ) const
+      {
+        return myFunctor( myLeft( anIndex ), myRight( anIndex ) );
+      }
+    };
+
+    BinaryImageExpression( const TLeft & aLeft, const TRight & aRight, const TFunctor & aFunctor )
+      : myLeft( aLeft ), myRight( aRight ), myFunctor( aFunctor )
+    {}
+
+    const Domain & domain() const
+    {
+      return myLeft.domain();
+    }
+
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    Value operator()( const Point & aPoint ) const
+    {
+      return myFunctor( myLeft( aPoint ), myRight( aPoint ) );
+    }
+
+    bool isLinearOver( const Domain & aDomain ) const
+    {
+      return myLeft.isLinearOver( aDomain ) && myRight.isLinearOver( aDomain );
+    }
+
+    Accessor accessor() const
+    {
+      Accessor accessor = { myLeft.accessor(), myRight.accessor(), myFunctor };
+      return accessor;
+    }
+
+  private:
+    TLeft myLeft;
+    TRight myRight;
+    TFunctor myFunctor;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SelectImageExpression
+  /**
+   * Description of template class 'SelectImageExpression' <p>
+   * \brief Aim: image expression whose value is the value of a first
+   * expression where a mask expression is true, and the value of a
+   * second one elsewhere (both values are read).
+   *
+   * @tparam TMask a type of image expression with values convertible to bool.
+   * @tparam TTrue a type of image expression.
+   * @tparam TFalse a type of image expression.
+   */
+  template <typename TMask, typename TTrue, typename TFalse>
+  class SelectImageExpression : public ImageExpression< SelectImageExpression<TMask, TTrue, TFalse> >
+  {
+    BOOST_STATIC_ASSERT(( boost::is_same< typename TMask::Domain, typename TTrue::Domain >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< typename TMask::Domain, typename TFalse::Domain >::value ));
+
+  public:
+    typedef SelectImageExpression<TMask, TTrue, TFalse> Self;
+    typedef typename TMask::Domain Domain;
+    typedef typename TMask::Point Point;
+    typedef typename std::common_type< typename TTrue::Value, typename TFalse::Value >::type Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isLinear = TMask::isLinear && TTrue::isLinear && TFalse::isLinear );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      typename TMask::Accessor myMask;
+      typename TTrue::Accessor myTrue;
+      typename TFalse::Accessor myFalse;
+
+      Value operator()( const std::size_t anIndex ) const
+      {
+        const Value t = myTrue( anIndex );
+        const Value f = myFalse( anIndex );
+        return myMask( anIndex ) ? t : f;
+      }
+    };
+
+    SelectImageExpression( const TMask & aMask, const TTrue & aTrue, const TFalse & aFalse )
+      : myMask( aMask ), myTrue( aTrue ), myFalse( aFalse )
+    {}
+
+    const Domain & domain() const
+    {
+      return myMask.domain();
+    }
+
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    Value operator()( const Point & aPoint ) const
+    {
+      return myMask( aPoint ) ? Value( myTrue( aPoint ) ) : Value( myFalse( aPoint ) );
+    }
+
+    bool isLinearOver( const Domain & aDomain ) const
+    {
+      return myMask.isLinearOver( aDomain ) && myTrue.isLinearOver( aDomain )
+        && myFalse.isLinearOver( aDomain );
+    }
+
+    Accessor accessor() const
+    {
+      Accessor accessor = { myMask.accessor(), myTrue.accessor(), myFalse.accessor() };
+      return accessor;
+    }
+
+  private:
+    TMask myMask;
+    TTrue myTrue;
+    TFalse myFalse;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConstantImageExpression
+  /**
+   * Description of template class 'ConstantImageExpression' <p>
+   * \brief Aim: image expression with the same value at each point
+   * (used for the scalars of expressions).
+   *
+   * @tparam TDomain a type of domain.
+   * @tparam TValue a type of value.
+   */
+  template <typename TDomain, typename TValue>
+  class ConstantImageExpression : public ImageExpression< ConstantImageExpression<TDomain, TValue> >
+  {
+  public:
+    typedef ConstantImageExpression<TDomain, TValue> Self;
+    typedef TDomain Domain;
+    typedef typename TDomain::Point Point;
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isLinear = true );
+
+    /// Value at a storage index
+    struct Accessor
+    {
+      Value myValue;
+
+      Value operator()( const std::size_t ) const
+      {
+        return myValue;
+      }
+    };
+
+    /**
+     * Constructor.
+     * @param aDomain the domain (aliased).
+     * @param aValue the value.
+     */
+    ConstantImageExpression( ConstAlias<Domain> aDomain, const Value & aValue )
+      : myDomain( &aDomain ), myValue( aValue )
+    {}
+
+    const Domain & domain() const
+    {
+      return *myDomain;
+    }
+
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    Value operator()( const Point & ) const
+    {
+      return myValue;
+    }
+
+    bool isLinearOver( const Domain & ) const
+    {
+      return true;
+    }
+
+    Accessor accessor() const
+    {
+      Accessor accessor = { myValue };
+      return accessor;
+    }
+
+  private:
+    const Domain * myDomain;
+    Value myValue;
+  };
+
+  namespace detail
+  {
+    /// Operators of image expressions, as functors.
+#define DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( NAME, OP )                  \
+    struct NAME                                                         \
+    {                                                                   \
+      template <typename T, typename U>                                 \
+      auto operator()( const T & x, const U & y ) const -> decltype( x OP y ) \
+      {                                                                 \
+        return x OP y;                                                  \
+      }                                                                 \
+    };
+
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionPlus, + )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionMinus, - )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionMultiplies, * )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionDivides, / )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionLess, < )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionLessEqual, <= )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionGreater, > )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionGreaterEqual, >= )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionEqual, == )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionNotEqual, != )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionAnd, && )
+    DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR( ImageExpressionOr, || )
+
+#undef DGTAL_IMAGE_EXPRESSION_BINARY_FUNCTOR
+
+    struct ImageExpressionNegate
+    {
+      template <typename T>
+      auto operator()( const T & x ) const -> decltype( - x )
+      {
+        return - x;
+      }
+    };
+
+    struct ImageExpressionNot
+    {
+      template <typename T>
+      bool operator()( const T & x ) const
+      {
+        return ! x;
+      }
+    };
+
+    struct ImageExpressionMin
+    {
+      template <typename T>
+      T operator()( const T & x, const T & y ) const
+      {
+        return ( y < x ) ? y : x;
+      }
+    };
+
+    struct ImageExpressionMax
+    {
+      template <typename T>
+      T operator()( const T & x, const T & y ) const
+      {
+        return ( x < y ) ? y : x;
+      }
+    };
+
+    /// Number of true values
+    struct ImageExpressionCount
+    {
+      template <typename T>
+      std::size_t operator()( const T & x ) const
+      {
+        return x ? 1 : 0;
+      }
+    };
+
+    /// Type of the sum of values: 64 bits integers for integral values
+    template <typename T, bool isIntegral = std::is_integral<T>::value>
+    struct ImageExpressionSum
+    {
+      typedef T Type;
+    };
+
+    template <typename T>
+    struct ImageExpressionSum<T, true>
+    {
+      typedef typename std::conditional< std::is_signed<T>::value,
+                                         DGtal::int64_t, DGtal::uint64_t >::type Type;
+    };
+  } // namespace detail
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // Construction of image expressions
+
+  /**
+   * @param anImage an image (model of CConstImage), aliased by the expression.
+   * @return the image expression made of @a anImage.
+   */
+  template <typename TImage>
+  ImageTerminal<TImage>
+  imageExpression( const TImage & anImage )
+  {
+    return ImageTerminal<TImage>( anImage );
+  }
+
+  /**
+   * @param anExpression an image expression.
+   * @param aFunctor a unary functor.
+   * @return the expression of the values of @a anExpression mapped by @a aFunctor.
+   */
+  template <typename TExpression, typename TFunctor>
+  UnaryImageExpression<TExpression, TFunctor>
+  mapValues( const ImageExpression<TExpression> & anExpression, const TFunctor & aFunctor )
+  {
+    return UnaryImageExpression<TExpression, TFunctor>( anExpression.derived(), aFunctor );
+  }
+
+  /**
+   * @tparam TValue the type of the resulting values.
+   * @param anExpression an image expression.
+   * @return the expression of the values of @a anExpression cast to @a TValue.
+   */
+  template <typename TValue, typename TExpression>
+  UnaryImageExpression< TExpression, functors::Cast<TValue> >
+  castValues( const ImageExpression<TExpression> & anExpression )
+  {
+    return UnaryImageExpression< TExpression, functors::Cast<TValue> >( anExpression.derived(),
+                                                                        functors::Cast<TValue>() );
+  }
+
+  /**
+   * @param aMask an image expression with values convertible to bool.
+   * @param aTrue an image expression.
+   * @param aFalse an image expression.
+   * @return the expression of the values of @a aTrue where @a aMask
+   * is true and of @a aFalse elsewhere.
+   */
+  template <typename TMask, typename TTrue, typename TFalse>
+  SelectImageExpression<TMask, TTrue, TFalse>
+  select( const ImageExpression<TMask> & aMask, const ImageExpression<TTrue> & aTrue,
+          const ImageExpression<TFalse> & aFalse )
+  {
+    return SelectImageExpression<TMask, TTrue, TFalse>( aMask.derived(), aTrue.derived(), aFalse.derived() );
+  }
+
+  /**
+   * @param aMask an image expression with values convertible to bool.
+   * @param aTrue an image expression.
+   * @param aFalse a value.
+   * @return the expression of the values of @a aTrue where @a aMask
+   * is true and @a aFalse elsewhere.
+   */
+  template <typename TMask, typename TTrue>
+  SelectImageExpression< TMask, TTrue, ConstantImageExpression< typename TMask::Domain, typename TTrue::Value > >
+  select( const ImageExpression<TMask> & aMask, const ImageExpression<TTrue> & aTrue,
+          const typename TTrue::Value & aFalse )
+  {
+    typedef ConstantImageExpression< typename TMask::Domain, typename TTrue::Value > Constant;
+    return SelectImageExpression<TMask, TTrue, Constant>( aMask.derived(), aTrue.derived(),
+                                                          Constant( aMask.derived().domain(), aFalse ) );
+  }
+
+  /// Element-wise operators between image expressions, and between
+  /// image expressions and scalars.
+#define DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( OP, FUNCTOR )                 \
+  template <typename TLeft, typename TRight>                            \
+  BinaryImageExpression<TLeft, TRight, detail::FUNCTOR>                 \
+  operator OP ( const ImageExpression<TLeft> & aLeft, const ImageExpression<TRight> & aRight ) \
+  {                                                                     \
+    return BinaryImageExpression<TLeft, TRight, detail::FUNCTOR>( aLeft.derived(), aRight.derived(), \
+                                                                  detail::FUNCTOR() ); \
+  }                                                                     \
+  template <typename TLeft, typename TScalar>                           \
+  typename std::enable_if< std::is_arithmetic<TScalar>::value,          \
+                           BinaryImageExpression< TLeft, ConstantImageExpression< typename TLeft::Domain, TScalar >, \
+                                                  detail::FUNCTOR > >::type \
+  operator OP ( const ImageExpression<TLeft> & aLeft, const TScalar & aRight ) \
+  {                                                                     \
+    typedef ConstantImageExpression< typename TLeft::Domain, TScalar > Constant; \
+    return BinaryImageExpression<TLeft, Constant, detail::FUNCTOR>( aLeft.derived(), \
+                                                                    Constant( aLeft.derived().domain(), aRight ), \
+                                                                    detail::FUNCTOR() ); \
+  }                                                                     \
+  template <typename TScalar, typename TRight>                          \
+  typename std::enable_if< std::is_arithmetic<TScalar>::value,          \
+                           BinaryImageExpression< ConstantImageExpression< typename TRight::Domain, TScalar >, TRight, \
+                                                  detail::FUNCTOR > >::type \
+  operator OP ( const TScalar & aLeft, const ImageExpression<TRight> & aRight ) \
+  {                                                                     \
+    typedef ConstantImageExpression< typename TRight::Domain, TScalar > Constant; \
+    return BinaryImageExpression<Constant, TRight, detail::FUNCTOR>( Constant( aRight.derived().domain(), aLeft ), \
+                                                                     aRight.derived(), detail::FUNCTOR() ); \
+  }
+
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( +, ImageExpressionPlus )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( -, ImageExpressionMinus )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( *, ImageExpressionMultiplies )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( /, ImageExpressionDivides )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( <, ImageExpressionLess )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( <=, ImageExpressionLessEqual )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( >, ImageExpressionGreater )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( >=, ImageExpressionGreaterEqual )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( ==, ImageExpressionEqual )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( !=, ImageExpressionNotEqual )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( &&, ImageExpressionAnd )
+  DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR( ||, ImageExpressionOr )
+
+#undef DGTAL_IMAGE_EXPRESSION_BINARY_OPERATOR
+
+  /**
+   * @param anExpression an image expression.
+   * @return the expression of the opposite values.
+   */
+  template <typename TExpression>
+  UnaryImageExpression<TExpression, detail::ImageExpressionNegate>
+  operator- ( const ImageExpression<TExpression> & anExpression )
+  {
+    return UnaryImageExpression<TExpression, detail::ImageExpressionNegate>( anExpression.derived(),
+                                                                             detail::ImageExpressionNegate() );
+  }
+
+  /**
+   * @param anExpression an image expression.
+   * @return the expression of the negated (boolean) values.
+   */
+  template <typename TExpression>
+  UnaryImageExpression<TExpression, detail::ImageExpressionNot>
+  operator! ( const ImageExpression<TExpression> & anExpression )
+  {
+    return UnaryImageExpression<TExpression, detail::ImageExpressionNot>( anExpression.derived(),
+                                                                          detail::ImageExpressionNot() );
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // Evaluation of image expressions
+
+  /**
+   * Writes the values of an expression in an image, on the domain of
+   * the image, which should be included in the domain of the
+   * expression. The evaluation is done by a single loop on the
+   * storage indices when possible (see ImageExpression), in parallel
+   * if OpenMP is enabled and @a aParallel is true.
+   *
+   * @param anImage the image (model of CImage).
+   * @param anExpression the image expression.
+   * @param aParallel if 'false', the evaluation is sequential.
+   */
+  template <typename TImage, typename TExpression>
+  void
+  imageFromExpression( TImage & anImage, const ImageExpression<TExpression> & anExpression,
+                       const bool aParallel = true );
+
+  /**
+   * @param anExpression the image expression.
+   * @param aParallel if 'false', the evaluation is sequential.
+   * @return the image of the values of @a anExpression on its domain.
+   */
+  template <typename TExpression>
+  ImageContainerBySTLVector< typename TExpression::Domain, typename TExpression::Value >
+  evaluate( const ImageExpression<TExpression> & anExpression, const bool aParallel = true );
+
+  /**
+   * Reduces the values of an expression on its domain with an
+   * associative functor, by a single loop on the storage indices when
+   * possible (see ImageExpression), in parallel if OpenMP is enabled
+   * and @a aParallel is true.
+   *
+   * @param anExpression the image expression.
+   * @param anInitialValue the initial value of the reduction.
+   * @param aFunctor an associative binary functor.
+   * @param aParallel if 'false', the reduction is sequential.
+   * @return the reduction of @a anInitialValue and of the values.
+   */
+  template <typename TExpression, typename TResult, typename TFunctor>
+  TResult
+  reduceValues( const ImageExpression<TExpression> & anExpression, const TResult & anInitialValue,
+                const TFunctor & aFunctor, const bool aParallel = true );
+
+  /**
+   * @param anExpression the image expression.
+   * @param aParallel if 'false', the reduction is sequential.
+   * @return the sum of the values of @a anExpression (computed with
+   * 64 bits integers for integral values).
+   */
+  template <typename TExpression>
+  typename detail::ImageExpressionSum<typename TExpression::Value>::Type
+  sumValues( const ImageExpression<TExpression> & anExpression, const bool aParallel = true );
+
+  /**
+   * @param anExpression the image expression (on a non-empty domain).
+   * @param aParallel if 'false', the reduction is sequential.
+   * @return the minimum of the values of @a anExpression.
+   */
+  template <typename TExpression>
+  typename TExpression::Value
+  minValue( const ImageExpression<TExpression> & anExpression, const bool aParallel = true );
+
+  /**
+   * @param anExpression the image expression (on a non-empty domain).
+   * @param aParallel if 'false', the reduction is sequential.
+   * @return the maximum of the values of @a anExpression.
+   */
+  template <typename TExpression>
+  typename TExpression::Value
+  maxValue( const ImageExpression<TExpression> & anExpression, const bool aParallel = true );
+
+  /**
+   * @param anExpression the image expression with values convertible to bool.
+   * @param aParallel if 'false', the reduction is sequential.
+   * @return the number of points where @a anExpression is true.
+   */
+  template <typename TExpression>
+  std::size_t
+  countValues( const ImageExpression<TExpression> & anExpression, const bool aParallel = true );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageExpression.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageExpression_h
+
+#undef ImageExpression_RECURSES
+#endif // else defined(ImageExpression_RECURSES)
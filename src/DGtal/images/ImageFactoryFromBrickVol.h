@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromBrickVol.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryFromBrickVol.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromBrickVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromBrickVol.h
+#else // defined(ImageFactoryFromBrickVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromBrickVol_RECURSES
+
+#if !defined ImageFactoryFromBrickVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromBrickVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/BrickVolFile.h"
+#include "DGtal/io/readers/BrickVolReader.h"
+#include "DGtal/io/writers/BrickVolWriter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromBrickVol
+  /**
+   * Description of template class 'ImageFactoryFromBrickVol' <p>
+   * \brief Aim: implements a factory from a BrickVol file (see
+   * BrickVolFile).
+   *
+   * @tparam TImageContainer an image container type (model of CImage).
+   *
+   * The factory images production (images are copied, so it's a creation process) is done with the function 'requestImage'
+   * so the deletion must be done with the function 'detachImage'.
+   * Only the bricks intersecting the requested domain are read and
+   * uncompressed, hence a TiledImage built on this factory (through
+   * an ImageCache) fetches the bricks of its tiles on demand. Tiles
+   * aligned with bricks are best: with bricks of size B, use N =
+   * size / B tiles per dimension when possible.
+   *
+   * The update of the original file is done with the function
+   * 'flushImage', which rewrites the bricks covered by the image; it
+   * does nothing when the factory is read-only. Since a flush
+   * compresses whole bricks, a write-back cache policy
+   * (ImageCacheWritePolicyWB) should be preferred.
+   *
+   * @see testBrickVol.cpp
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromBrickVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromBrickVol<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_STATIC_ASSERT(TImageContainer::Domain::dimension == 3);
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename Domain::Point Point;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef typename OutputImage::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param aFilename BrickVol filename.
+     * @param writable when 'true', flushImage writes into the file.
+     */
+    ImageFactoryFromBrickVol(const std::string & aFilename, bool writable = false);
+
+    /**
+     * Destructor.
+     */
+    ~ImageFactoryFromBrickVol() {}
+
+  private:
+
+    ImageFactoryFromBrickVol( const ImageFactoryFromBrickVol & other );
+
+    ImageFactoryFromBrickVol & operator=( const ImageFactoryFromBrickVol & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /////////////////// Accessors //////////////////
+
+    /**
+     * @return the size of the bricks of the file.
+     */
+    Point brickSize() const;
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myFile.isValid() && myDomain.isValid();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain aDomain.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain);
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage);
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage)
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The BrickVol file.
+    BrickVolFile myFile;
+
+    /// The image domain.
+    Domain myDomain;
+
+  }; // end of class ImageFactoryFromBrickVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromBrickVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromBrickVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromBrickVol<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromBrickVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromBrickVol_h
+
+#undef ImageFactoryFromBrickVol_RECURSES
+#endif // else defined(ImageFactoryFromBrickVol_RECURSES)
@@ -0,0 +1,348 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryWithPrefetch.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryWithPrefetch.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryWithPrefetch_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryWithPrefetch.h
+#else // defined(ImageFactoryWithPrefetch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryWithPrefetch_RECURSES
+
+#if !defined ImageFactoryWithPrefetch_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryWithPrefetch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <list>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/base/Alias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryWithPrefetch
+  /**
+   * Description of template class 'ImageFactoryWithPrefetch' <p>
+   * \brief Aim: implements a factory which loads images in advance,
+   * in background threads, through another factory.
+   *
+   * @tparam TImageFactory an image factory type (model of CImageFactory), e.g. ImageFactoryFromHDF5.
+   *
+   * The function 'prefetch' queues the request of an image of a
+   * given domain; a small pool of worker threads requests the queued
+   * images from the underlying factory. When 'requestImage' is later
+   * called with the same domain, the prefetched image is returned
+   * (waiting for its loading to finish if needed), otherwise the image
+   * is requested synchronously. The time spent waiting in
+   * 'requestImage' (the stall time) is measured.
+   *
+   * The queue is bounded: when it is full, the oldest prefetched
+   * image that was not requested yet is detached, and requests are
+   * dropped when all the queued images are still being loaded.
+   * Flushing an image discards the prefetched images with the same
+   * domain, which may be out of date.
+   *
+   * Calls to the underlying factory are serialized, unless the
+   * factory is declared thread-safe, in which case several images can
+   * be requested at the same time (and several workers are useful).
+   *
+   * A TiledImage built on this factory prefetches the next tiles of
+   * its scans, see TiledImage::setPrefetcher.
+   *
+   * @see testTiledImage.cpp
+   */
+  template <typename TImageFactory>
+  class ImageFactoryWithPrefetch
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryWithPrefetch<TImageFactory> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    ///Types copied from the factory
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::Domain Domain;
+    typedef typename ImageFactory::OutputImage OutputImage;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the underlying image factory.
+     * @param aQueueSize the maximal number of prefetched images (loading or loaded).
+     * @param nbWorkers the number of worker threads.
+     * @param threadSafeFactory when 'true', the underlying factory may
+     * request several images at the same time (e.g. while an other
+     * image is flushed), otherwise its calls are serialized.
+     */
+    ImageFactoryWithPrefetch(Alias<ImageFactory> anImageFactory,
+                             unsigned int aQueueSize = 8,
+                             unsigned int nbWorkers = 1,
+                             bool threadSafeFactory = false);
+
+    /**
+     * Destructor. Stops the workers and detaches the prefetched
+     * images that were not requested.
+     */
+    ~ImageFactoryWithPrefetch();
+
+  private:
+
+    ImageFactoryWithPrefetch( const ImageFactoryWithPrefetch & other );
+
+    ImageFactoryWithPrefetch & operator=( const ImageFactoryWithPrefetch & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImageFactory->domain();
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myImageFactory->isValid();
+    }
+
+    /**
+     * Queues the request of an image of domain aDomain. Does nothing
+     * if such an image is already queued.
+     *
+     * @param aDomain the domain.
+     *
+     * @return 'false' if the request was dropped (queue full).
+     */
+    bool prefetch(const Domain &aDomain);
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain, prefetched if possible.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain);
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage);
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage);
+
+    /**
+     * @return the number of requested images that were already prefetched.
+     */
+    unsigned int nbPrefetchHits() const;
+
+    /**
+     * @return the number of requested images that were being prefetched.
+     */
+    unsigned int nbPrefetchWaits() const;
+
+    /**
+     * @return the number of requested images that were not prefetched.
+     */
+    unsigned int nbPrefetchMisses() const;
+
+    /**
+     * @return the number of dropped prefetch requests.
+     */
+    unsigned int nbPrefetchDropped() const;
+
+    /**
+     * @return the time spent waiting for images in requestImage (in seconds).
+     */
+    double stallTime() const;
+
+    /**
+     * Resets the statistics.
+     */
+    void resetStats();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Loading state of a prefetched image
+    enum State { PENDING, LOADING, LOADED };
+
+    /// A prefetched image
+    struct Entry
+    {
+      Domain domain;
+      OutputImage * image;
+      State state;
+      bool discarded;
+      /// Number of requestImage calls waiting for the entry to be loaded
+      unsigned int waiters;
+    };
+    typedef std::list<Entry> Entries;
+
+    /// Alias on the underlying image factory
+    ImageFactory * myImageFactory;
+
+    /// Prefetched images, the oldest first
+    Entries myEntries;
+
+    /// Maximal number of prefetched images
+    std::size_t myQueueSize;
+
+    /// If 'true', requests to the factory are not serialized
+    bool myThreadSafeFactory;
+
+    /// Worker threads
+    std::vector<std::thread> myWorkers;
+
+    /// If 'true', the workers stop
+    bool myStop;
+
+    /// Mutex guarding the entries and the statistics
+    mutable std::mutex myMutex;
+
+    /// Mutex serializing the calls to the factory
+    std::mutex myFactoryMutex;
+
+    /// Signals pending entries to the workers
+    std::condition_variable myPendingCondition;
+
+    /// Signals loaded entries to requestImage
+    std::condition_variable myLoadedCondition;
+
+    /// Statistics
+    unsigned int myHits, myWaits, myMisses, myDropped;
+    double myStallTime;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Loop of the worker threads.
+     */
+    void work();
+
+    /**
+     * Requests an image from the factory.
+     * @param aDomain the domain.
+     * @return the image.
+     */
+    OutputImage * load(const Domain &aDomain);
+
+    /**
+     * Removes an entry whose image, if any, was taken. An entry with
+     * waiters is only marked as discarded: the last waiter removes it.
+     * The mutex must be held.
+     * @param it an iterator on the entry.
+     * @return an iterator on the next entry.
+     */
+    typename Entries::iterator removeEntry(typename Entries::iterator it);
+
+    /**
+     * Detaches images from the factory.
+     * @param images the images.
+     */
+    void detachAll(const std::vector<OutputImage *> & images);
+
+    /**
+     * @param a a domain.
+     * @param b a domain.
+     * @return 'true' if a and b are the same domain.
+     */
+    static bool sameDomain(const Domain & a, const Domain & b)
+    {
+      return (a.lowerBound() == b.lowerBound()) && (a.upperBound() == b.upperBound());
+    }
+
+  }; // end of class ImageFactoryWithPrefetch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryWithPrefetch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryWithPrefetch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageFactory>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryWithPrefetch<TImageFactory> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryWithPrefetch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryWithPrefetch_h
+
+#undef ImageFactoryWithPrefetch_RECURSES
+#endif // else defined(ImageFactoryWithPrefetch_RECURSES)
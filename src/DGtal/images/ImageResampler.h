@@ -0,0 +1,257 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageResampler.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageResampler.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageResampler_RECURSES)
+#error Recursive header files inclusion detected in ImageResampler.h
+#else // defined(ImageResampler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageResampler_RECURSES
+
+#if !defined ImageResampler_h
+/** Prevents repeated inclusion of headers. */
+#define ImageResampler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageResampler
+  /**
+   * Description of template class 'ImageResampler' <p>
+   *
+   * \brief Aim: resamples a whole image through an affine
+   * transformation, e.g. a rigid transformation (see
+   * RigidTransformation2D.h and RigidTransformation3D.h).
+   *
+   * The transformation maps each point of the resulting image to a
+   * real point of the source image (i.e. it is a backward
+   * transformation), whose value is obtained by nearest neighbor or
+   * (bi,tri,...)linear interpolation.
+   *
+   * Contrary to a ConstImageAdapter with a backward transformation
+   * functor, the transformation is not computed for each point: the
+   * real points of a row of the resulting domain are obtained by
+   * adding a constant step to the image of its first point, in a
+   * contiguous buffer per dimension (a loop that compilers
+   * vectorize). Rows are processed in parallel if OpenMP is enabled,
+   * except for bool values (whose std::vector storage packs several
+   * points per word).
+   *
+   * @code
+   * typedef functors::BackwardRigidTransformation3D<Z3i::Space> Backward;
+   * ImageResampler<Z3i::Space> resampler =
+   *   ImageResampler<Z3i::Space>::fromTransform( Backward( origin, axis, angle, translation ) );
+   * ImageContainerBySTLVector<Z3i::Domain, unsigned char> result =
+   *   resampler.resample( image, domain, ImageResampler<Z3i::Space>::LINEAR );
+   * @endcode
+   *
+   * @tparam TSpace a model of CSpace.
+   *
+   * @see testImageResampler.cpp
+   * @see benchmarkImageResampler.cpp
+   */
+  template <typename TSpace>
+  class ImageResampler
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef ImageResampler<TSpace> Self;
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain<Space> Domain;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Space::dimension );
+
+    /// Interpolation of the values at real points
+    enum Interpolation {
+      /// value of the closest point
+      NEAREST,
+      /// (bi,tri,...)linear interpolation of the values of the
+      /// 2^dimension surrounding points (Value should be convertible
+      /// to and from double)
+      LINEAR };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor from an affine transformation p -> aShift +
+     * sum_k p[k] * aColumns[k].
+     *
+     * @param aColumns the columns of the linear part of the transformation.
+     * @param aShift the image of the origin.
+     */
+    ImageResampler( const std::array<RealVector, dimension> & aColumns,
+                    const RealPoint & aShift );
+
+    /**
+     * @tparam TRealTransform a type of affine transformation
+     * providing a method RealPoint transform( const RealPoint & ), such
+     * as BackwardRigidTransformation2D or BackwardRigidTransformation3D.
+     * @param aTransform the transformation.
+     * @return the resampler for this transformation.
+     */
+    template <typename TRealTransform>
+    static Self fromTransform( const TRealTransform & aTransform );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aPoint a point.
+     * @return the image of @a aPoint by the transformation.
+     */
+    RealPoint operator()( const Point & aPoint ) const;
+
+    /**
+     * Resamples an image: the value of each point of @a aDomain is the
+     * value of the source image at the image of the point by the
+     * transformation, or @a anOutsideValue if it is not in the source
+     * domain.
+     *
+     * @note with OpenMP, Value should not be bool, since rows of a
+     * std::vector<bool> cannot be written in parallel.
+     *
+     * @tparam TImage a model of CConstImage on a HyperRectDomain of Space.
+     * @param anImage the source image.
+     * @param aDomain the domain of the resulting image (e.g. given by
+     * DomainRigidTransformation3D with the forward transformation).
+     * @param anInterpolation the interpolation of the values.
+     * @param anOutsideValue the value of the points transformed
+     * outside of the source domain.
+     * @return the resampled image.
+     */
+    template <typename TImage>
+    ImageContainerBySTLVector<Domain, typename TImage::Value>
+    resample( const TImage & anImage, const Domain & aDomain,
+              const Interpolation anInterpolation = NEAREST,
+              const typename TImage::Value & anOutsideValue = typename TImage::Value() ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Samples a row at nearest points.
+     *
+     * @param anImage the source image.
+     * @param aCoordinates the real coordinates of the row points, per dimension.
+     * @param aWidth the number of points of the row.
+     * @param anOutsideValue the value of the points outside the source domain.
+     * @param anOutput the resulting image.
+     * @param anIndex the index of the first point of the row in @a anOutput.
+     */
+    template <typename TImage>
+    static void sampleNearest( const TImage & anImage, const double * aCoordinates,
+                               const std::size_t aWidth,
+                               const typename TImage::Value & anOutsideValue,
+                               ImageContainerBySTLVector<Domain, typename TImage::Value> & anOutput,
+                               const std::size_t anIndex );
+
+    /**
+     * Samples a row with linear interpolation.
+     *
+     * @param anImage the source image.
+     * @param aCoordinates the real coordinates of the row points, per dimension.
+     * @param aWidth the number of points of the row.
+     * @param anOutsideValue the value of the points outside the source domain.
+     * @param anOutput the resulting image.
+     * @param anIndex the index of the first point of the row in @a anOutput.
+     */
+    template <typename TImage>
+    static void sampleLinear( const TImage & anImage, const double * aCoordinates,
+                              const std::size_t aWidth,
+                              const typename TImage::Value & anOutsideValue,
+                              ImageContainerBySTLVector<Domain, typename TImage::Value> & anOutput,
+                              const std::size_t anIndex );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Columns of the linear part of the transformation
+    std::array<RealVector, dimension> myColumns;
+
+    /// Image of the origin
+    RealPoint myShift;
+
+  }; // end of class ImageResampler
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageResampler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageResampler' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageResampler<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageResampler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageResampler_h
+
+#undef ImageResampler_RECURSES
+#endif // else defined(ImageResampler_RECURSES)
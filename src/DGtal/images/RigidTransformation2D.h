@@ -100,12 +100,28 @@ public:
     inline
     Point operator()( const Point& aInput ) const
     {
+        const RealPoint q = transform( RealPoint( aInput ) );
         Point p;
-        p[0] = std::floor ( ( ( t_cos * ( aInput[0] - origin[0] ) -
-               t_sin * ( aInput[1] - origin[1] ) ) + translation[0] ) + origin[0] + 0.5 );
+        for ( Dimension k = 0; k < 2; k++ )
+          p[k] = std::floor ( q[k] + 0.5 );
+        return p;
+    }
+
+    /**
+       * Transformation of a real point, without rounding (e.g. for
+       * interpolation, see ImageResampler).
+       *
+       * @return the transformed real point.
+       */
+    inline
+    RealPoint transform( const RealPoint& aInput ) const
+    {
+        RealPoint p;
+        p[0] = ( ( t_cos * ( aInput[0] - origin[0] ) -
+               t_sin * ( aInput[1] - origin[1] ) ) + translation[0] ) + origin[0];
 
-        p[1] = std::floor ( ( ( t_sin * ( aInput[0] - origin[0] ) +
-               t_cos * ( aInput[1] - origin[1] ) ) + translation[1] ) + origin[1] + 0.5 );
+        p[1] = ( ( t_sin * ( aInput[0] - origin[0] ) +
+               t_cos * ( aInput[1] - origin[1] ) ) + translation[1] ) + origin[1];
         return p;
     }
 
@@ -164,12 +180,28 @@ public:
     inline
     Point operator()( const Point& aInput ) const
     {
+        const RealPoint q = transform( RealPoint( aInput ) );
         Point p;
-        p[0] = std::floor ( ( t_cos * (aInput[0] - translation[0] - origin[0] ) +
-               t_sin * ( aInput[1] - translation[1] - origin[1] ) ) + origin[0] + 0.5 );
+        for ( Dimension k = 0; k < 2; k++ )
+          p[k] = std::floor ( q[k] + 0.5 );
+        return p;
+    }
+
+    /**
+       * Transformation of a real point, without rounding (e.g. for
+       * interpolation, see ImageResampler).
+       *
+       * @return the transformed real point.
+       */
+    inline
+    RealPoint transform( const RealPoint& aInput ) const
+    {
+        RealPoint p;
+        p[0] = ( t_cos * (aInput[0] - translation[0] - origin[0] ) +
+               t_sin * ( aInput[1] - translation[1] - origin[1] ) ) + origin[0];
 
-        p[1] = std::floor ( ( -t_sin * ( aInput[0] - translation[0] - origin[0] ) +
-               t_cos * ( aInput[1] - translation[1] - origin[1] ) ) + origin[1] + 0.5 );
+        p[1] = ( -t_sin * ( aInput[0] - translation[0] - origin[0] ) +
+               t_cos * ( aInput[1] - translation[1] - origin[1] ) ) + origin[1];
         return p;
     }
 
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <functional>
+#include <memory>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -71,6 +73,14 @@ namespace DGtal
    * @note It is important to take into account that read and write policies are passed as aliases in the TiledImage constructor,
    * so for example, if two TiledImage instances are successively created with the same read policy instance,
    * the state of the cache for a given time is therefore the same for the two TiledImage instances !
+   *
+   * @note operator() and setValue can be called concurrently by several threads on the same TiledImage: its ImageCache
+   * serializes the accesses to the policies and to the image factory, while the reads of a tile in cache only lock
+   * the shard of the tile (see ImageCache). The tiled iterators pin their current tile (see pinTileFromBlockCoords):
+   * a tile evicted by another thread while an iterator is on it stays alive, and is flushed and detached when the
+   * iterator leaves it. The tiles returned by findTileFromBlockCoords are not pinned and may be detached by another
+   * thread. With a memory budget policy (ImageCacheReadPolicyLRU or ImageCacheReadPolicyARC), the cache is sized in
+   * bytes rather than in tiles; the pinned tiles may exceed the budget. The iterators must not outlive the TiledImage.
    */
   template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
   class TiledImage
@@ -118,15 +128,18 @@ namespace DGtal
                Alias<ImageCacheReadPolicy> aReadPolicy,
                Alias<ImageCacheWritePolicy> aWritePolicy,
                typename Domain::Integer N):
-      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy), myLookAhead(0)
     {
-      myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
-
       m_lowerBound = myImageFactory->domain().lowerBound();
       m_upperBound = myImageFactory->domain().upperBound();
 
       for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
         mySize[i] = (m_upperBound[i]-m_lowerBound[i]+1)/myN;
+
+      // one key per tile for the read hits without the cache mutex
+      myBlockCoordsUpperBound = findBlockCoordsFromPoint(m_upperBound);
+      myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy,
+                                      findBlockIndexFromBlockCoords(myBlockCoordsUpperBound)+1);
     }
 
     /**
@@ -151,14 +164,19 @@ namespace DGtal
       myImageFactory = other.myImageFactory;
       myReadPolicy = other.myReadPolicy;
       myWritePolicy = other.myWritePolicy;
-
-      myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
+      myPrefetch = other.myPrefetch;
+      myLookAhead = other.myLookAhead;
 
       m_lowerBound = myImageFactory->domain().lowerBound();
       m_upperBound = myImageFactory->domain().upperBound();
 
       for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
         mySize[i] = (m_upperBound[i]-m_lowerBound[i]+1)/myN;
+
+      // one key per tile for the read hits without the cache mutex
+      myBlockCoordsUpperBound = findBlockCoordsFromPoint(m_upperBound);
+      myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy,
+                                      findBlockIndexFromBlockCoords(myBlockCoordsUpperBound)+1);
     }
 
     /**
@@ -174,14 +192,19 @@ namespace DGtal
           myImageFactory = other.myImageFactory;
           myReadPolicy = other.myReadPolicy;
           myWritePolicy = other.myWritePolicy;
-
-          myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
+          myPrefetch = other.myPrefetch;
+          myLookAhead = other.myLookAhead;
 
           m_lowerBound = myImageFactory->domain().lowerBound();
           m_upperBound = myImageFactory->domain().upperBound();
 
           for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
             mySize[i] = (m_upperBound[i]-m_lowerBound[i]+1)/myN;
+
+          // one key per tile for the read hits without the cache mutex
+          myBlockCoordsUpperBound = findBlockCoordsFromPoint(m_upperBound);
+          myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy,
+                                          findBlockIndexFromBlockCoords(myBlockCoordsUpperBound)+1);
         }
 
         return *this;
@@ -203,24 +226,15 @@ namespace DGtal
     }
 
     /**
-     * Returns the block coords domain.
+     * Returns the block coords domain, up to the block coords of the
+     * upper bound of the image domain (there are more than N tiles
+     * along the dimensions that the tile width does not divide).
      *
      * @return the block coords domain.
      */
     const Domain domainBlockCoords() const
     {
-      Point lowerBoundCords, upperBoundCoords;
-
-      for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
-        {
-          lowerBoundCords[i] = 0;
-          upperBoundCoords[i] = myN;
-
-          if (((m_upperBound[i]-m_lowerBound[i]+1) % myN) == 0)
-            upperBoundCoords[i]--;
-        }
-
-      return Domain(lowerBoundCords, upperBoundCoords);
+      return Domain(Point::diagonal(0), myBlockCoordsUpperBound);
     }
 
     /////////////////////////// Custom Iterator /////////////
@@ -261,8 +275,9 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
             myTiledRangeIterator = myTile->range().begin();
+            myTiledImage->prefetchTilesAfter( myBlockCoordsIterator );
           }
       }
 
@@ -281,8 +296,9 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
             myTiledRangeIterator = myTile->range().begin(aPoint);
+            myTiledImage->prefetchTilesAfter( myBlockCoordsIterator );
           }
       }
 
@@ -340,8 +356,9 @@ namespace DGtal
             if ( myBlockCoordsIterator == myTiledImage->domainBlockCoords().end() )
               return;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
             myTiledRangeIterator = myTile->range().begin();
+            myTiledImage->prefetchTilesAfter( myBlockCoordsIterator );
           }
       }
 
@@ -380,7 +397,7 @@ namespace DGtal
           {
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -403,7 +420,7 @@ namespace DGtal
 
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -436,8 +453,8 @@ namespace DGtal
       /// TiledImage pointer
       const TiledImage *myTiledImage;
 
-      /// Alias on the current tile
-      ImageContainer * myTile;
+      /// Current tile, pinned in the cache
+      std::shared_ptr<ImageContainer> myTile;
 
       /// Current tiled range iterator
       TiledRangeIterator myTiledRangeIterator;
@@ -649,6 +666,24 @@ namespace DGtal
       return low;
     }
 
+    /**
+     * Get the index of a tile from its block coords (the tiles are
+     * numbered in the scan order of their block coords).
+     *
+     * @param aCoord the block coords.
+     * @return the index of the tile, less than the number of tiles.
+     */
+    std::size_t findBlockIndexFromBlockCoords(const Point & aCoord) const
+    {
+      ASSERT(aCoord.isLower(myBlockCoordsUpperBound));
+
+      std::size_t index = 0;
+      for(typename DGtal::Dimension i=Domain::dimension; i-- > 0; )
+        index = index*(myBlockCoordsUpperBound[i]+1) + aCoord[i];
+
+      return index;
+    }
+
     /**
      * Get the domain with his block coords.
      *
@@ -675,6 +710,57 @@ namespace DGtal
       return di;
     }
 
+    /**
+     * Sets a prefetcher (e.g. an ImageFactoryWithPrefetch, usually the
+     * image factory of this TiledImage): when a scan (TiledIterator)
+     * enters a tile, the aLookAhead next tiles in the scan order are
+     * passed to aPrefetcher.prefetch, so that they can be loaded in
+     * background while the current tile is processed. Tiles already
+     * in the cache may be prefetched again: the prefetcher must bound
+     * its queue.
+     *
+     * @tparam TPrefetcher a type providing a 'bool prefetch(const Domain &)' method.
+     * @param aPrefetcher alias on the prefetcher.
+     * @param aLookAhead the number of tiles to prefetch, 0 to disable the prefetching.
+     */
+    template <typename TPrefetcher>
+    void setPrefetcher(TPrefetcher & aPrefetcher, unsigned int aLookAhead)
+    {
+      TPrefetcher * prefetcher = &aPrefetcher;
+      myPrefetch = [prefetcher] (const Domain & aDomain) { return prefetcher->prefetch(aDomain); };
+      myLookAhead = aLookAhead;
+    }
+
+    /**
+     * @return the number of tiles prefetched ahead of the scans.
+     */
+    unsigned int lookAhead() const
+    {
+      return myLookAhead;
+    }
+
+    /**
+     * Prefetches the tiles following a block in the scan order (see
+     * setPrefetcher). Does nothing without prefetcher.
+     *
+     * @param aBlockCoordsIterator the block coords of the current tile.
+     */
+    template <typename TBlockCoordsIterator>
+    void prefetchTilesAfter(TBlockCoordsIterator aBlockCoordsIterator) const
+    {
+      if (!myPrefetch)
+        return;
+
+      const Domain blocks = domainBlockCoords();
+      for (unsigned int i = 0; i < myLookAhead; i++)
+        {
+          ++aBlockCoordsIterator;
+          if (aBlockCoordsIterator == blocks.end())
+            return;
+          myPrefetch(findSubDomainFromBlockCoords(*aBlockCoordsIterator));
+        }
+    }
+
     /**
      * Returns an ImageContainer pointer for the block coords aCoord.
      *
@@ -685,16 +771,22 @@ namespace DGtal
     {
       ASSERT(domainBlockCoords().isInside(aCoord));
 
-      Domain d = findSubDomainFromBlockCoords( aCoord );
-      ImageContainer *tile = myImageCache->getPage(d);
-      if (!tile)
-        {
-          myImageCache->incCacheMissRead();
-          myImageCache->update(d);
-          tile = myImageCache->getPage(d);
-        }
+      return myImageCache->getPageOrUpdate( findSubDomainFromBlockCoords( aCoord ) );
+    }
+
+    /**
+     * Returns the tile for the block coords aCoord, pinned in the
+     * cache: it is not detached while the returned pointer (or one of
+     * its copies) is alive, even if another thread evicts it.
+     *
+     * @param aCoord the block coords.
+     * @return a pointer on the tile, releasing the pin when destroyed.
+     */
+    std::shared_ptr<ImageContainer> pinTileFromBlockCoords(const Point & aCoord) const
+    {
+      ASSERT(domainBlockCoords().isInside(aCoord));
 
-      return tile;
+      return myImageCache->pinPageOrUpdate( findSubDomainFromBlockCoords( aCoord ) );
     }
 
     /**
@@ -707,31 +799,18 @@ namespace DGtal
     {
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
-      typename OutputImage::Value aValue;
-      bool res;
-
-      res = myImageCache->read(aPoint, aValue);
+      // A hit only locks the shard of the tile, a miss loads the tile under the cache lock.
+      const Point coords = findBlockCoordsFromPoint(aPoint);
+      const std::size_t index = findBlockIndexFromBlockCoords(coords);
 
-      if (res)
+      typename OutputImage::Value aValue;
+      if (myImageCache->read(aPoint, index, aValue))
         return aValue;
-      else
-        {
-          myImageCache->incCacheMissRead();
-          Domain d;
+
 #ifdef DEBUG_VERBOSE
-          trace.info()<<"+";
+      trace.info()<<"+";
 #endif 
-          d = findSubDomain(aPoint);
-
-          myImageCache->update(d);
-
-          myImageCache->read(aPoint, aValue);
-
-          return aValue;
-        }
-
-      // Unspecified behavior, returning the default constructed value.
-      return aValue;
+      return myImageCache->readOrUpdate(aPoint, findSubDomainFromBlockCoords(coords), index);
     }
 
     /**
@@ -744,14 +823,9 @@ namespace DGtal
     {
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
-      if (myImageCache->write(aPoint, aValue))
-        return;
-      else
-        {
-          myImageCache->incCacheMissWrite();
-          myImageCache->update(findSubDomain(aPoint));
-          myImageCache->write(aPoint, aValue);
-        }
+      const Point coords = findBlockCoordsFromPoint(aPoint);
+      myImageCache->writeOrUpdate(aPoint, findSubDomainFromBlockCoords(coords),
+                                  findBlockIndexFromBlockCoords(coords), aValue);
     }
 
     /**
@@ -771,7 +845,41 @@ namespace DGtal
     }
 
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead()
+    {
+      return myImageCache->getCacheHitRead();
+    }
+
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite()
+    {
+      return myImageCache->getCacheHitWrite();
+    }
+
+    /**
+     * Get the cacheEviction value (number of tiles detached from the cache).
+     */
+    unsigned int getCacheEviction()
+    {
+      return myImageCache->getCacheEviction();
+    }
+
+    /**
+     * Writes the tiles in cache to the image of the image factory
+     * (see ImageCache::flushCache), e.g. before reading that image
+     * when the cache has a write-back policy. The tiles stay in cache.
+     */
+    void flushCache()
+    {
+      myImageCache->flushCache();
+    }
+
+    /**
+     * Clear the cache and reset the cache hits, misses and evictions
      */
     void clearCacheAndResetCacheMisses()
     {
@@ -796,12 +904,21 @@ namespace DGtal
     /// domain lower and upper bound
     Point m_lowerBound, m_upperBound;
 
+    /// block coords of m_upperBound, upper bound of domainBlockCoords()
+    Point myBlockCoordsUpperBound;
+
     /// TImageCacheReadPolicy pointer
     TImageCacheReadPolicy *myReadPolicy;
 
     /// TImageCacheWritePolicy pointer
     TImageCacheWritePolicy *myWritePolicy;
 
+    /// Prefetch function (see setPrefetcher)
+    std::function<bool(const Domain &)> myPrefetch;
+
+    /// Number of tiles prefetched ahead of the scans
+    unsigned int myLookAhead;
+
     // ------------------------- Internals ------------------------------------
 
   }; // end of class TiledImage
@@ -0,0 +1,344 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolFile.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BrickVolFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolFile_RECURSES)
+#error Recursive header files inclusion detected in BrickVolFile.h
+#else // defined(BrickVolFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolFile_RECURSES
+
+#if !defined BrickVolFile_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include <map>
+#include <mutex>
+#include <cstdio>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BrickVolFile
+  /**
+   * Description of class 'BrickVolFile' <p>
+   * \brief Aim: low-level access to a "BrickVol" file, a chunked
+   * variant of the Vol format where the volume is cut into fixed-size
+   * bricks (e.g. 64x64x64 voxels), each brick being compressed
+   * independently. Any brick can hence be read without inflating the
+   * rest of the volume.
+   *
+   * The file starts with a text header in the style of Vol files (one
+   * "Field: value" per line, ended by a line "."):
+   * @code
+   * Brick-Vol: 1
+   * X: 200
+   * Y: 100
+   * Z: 50
+   * Lower-X: 0
+   * Lower-Y: 0
+   * Lower-Z: 0
+   * Brick-X: 64
+   * Brick-Y: 64
+   * Brick-Z: 64
+   * Codec: zlib
+   * .
+   * @endcode
+   * It is followed by the brick index, i.e. for each brick a pair
+   * (offset in the file, compressed size) of little-endian 64 bits
+   * integers, and by the compressed bricks. Bricks are numbered with
+   * the first coordinate varying fastest, and so are the voxels
+   * (unsigned char, as in Vol files) within a brick. Bricks on the
+   * upper border of the volume are truncated to the volume. A brick
+   * with a null size in the index has not been written yet and is
+   * made of zeros.
+   *
+   * Codecs are 'none' and 'zlib'.
+   *
+   * A rewritten brick stays in place when it fits in the space it
+   * used, and otherwise moves to the first free gap large enough (left
+   * by bricks that moved), or to the end of the file. Reopening a file
+   * finds its gaps again, so that the file does not grow without bound
+   * when the same bricks are rewritten.
+   *
+   * Reading bricks is thread-safe; decode() and encode() may be called
+   * concurrently. This class is used by BrickVolReader, BrickVolWriter
+   * and ImageFactoryFromBrickVol.
+   */
+  class BrickVolFile
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    /// Compression scheme of the bricks.
+    enum Codec { NONE, ZLIB };
+
+    typedef DGtal::int64_t Integer;
+    /// Coordinates of a voxel or of a brick, or sizes.
+    typedef std::array<Integer, 3> Coordinates;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object is not bound to a file.
+     */
+    BrickVolFile();
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~BrickVolFile();
+
+    /**
+     * Opens an existing file and reads its header and brick index.
+     *
+     * @param filename the file name.
+     * @param writable when 'true', bricks can be rewritten with writeBrick.
+     * @throw IOException if the file cannot be opened or is not valid.
+     */
+    void open( const std::string & filename, bool writable = false );
+
+    /**
+     * Creates a file for a volume, whose bricks are all empty.
+     *
+     * @param filename the file name.
+     * @param lower the coordinates of the first voxel.
+     * @param size the size of the volume.
+     * @param brick the size of the bricks.
+     * @param codec the compression scheme of the bricks.
+     * @throw IOException if the file cannot be written.
+     */
+    void create( const std::string & filename,
+                 const Coordinates & lower, const Coordinates & size,
+                 const Coordinates & brick, Codec codec = ZLIB );
+
+    /**
+     * Closes the file.
+     */
+    void close();
+
+  private:
+    BrickVolFile( const BrickVolFile & other ) = delete;
+    BrickVolFile & operator=( const BrickVolFile & other ) = delete;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return 'true' if a file is open.
+    bool isOpen() const;
+
+    /// @return 'true' if bricks can be written.
+    bool isWritable() const;
+
+    /// @return the coordinates of the first voxel.
+    const Coordinates & lowerBound() const;
+
+    /// @return the coordinates of the last voxel.
+    Coordinates upperBound() const;
+
+    /// @return the size of the volume.
+    const Coordinates & size() const;
+
+    /// @return the size of the bricks.
+    const Coordinates & brickSize() const;
+
+    /// @return the compression scheme of the bricks.
+    Codec codec() const;
+
+    /// @return the number of bricks.
+    std::size_t nbBricks() const;
+
+    /**
+     * @param i a brick index.
+     * @param[out] lower the coordinates of the first voxel of the brick.
+     * @param[out] upper the coordinates of the last voxel of the brick.
+     */
+    void brickBounds( std::size_t i, Coordinates & lower, Coordinates & upper ) const;
+
+    /**
+     * @param lower the first voxel of a box.
+     * @param upper the last voxel of a box.
+     * @return the indices of the bricks intersecting the box.
+     */
+    std::vector<std::size_t> bricks( const Coordinates & lower,
+                                     const Coordinates & upper ) const;
+
+    /**
+     * Reads a compressed brick.
+     * @param i a brick index.
+     * @param[out] blob the compressed brick (empty for an empty brick).
+     */
+    void readBrick( std::size_t i, std::vector<unsigned char> & blob ) const;
+
+    /**
+     * Writes a compressed brick, in place when it fits in the space of
+     * its previous version, in a free gap or at the end of the file
+     * otherwise.
+     * @param i a brick index.
+     * @param blob the compressed brick.
+     */
+    void writeBrick( std::size_t i, const std::vector<unsigned char> & blob );
+
+    /**
+     * Uncompresses a brick.
+     * @param i a brick index.
+     * @param blob the compressed brick, as given by readBrick.
+     * @param[out] voxels the voxels of the brick.
+     */
+    void decode( std::size_t i, const std::vector<unsigned char> & blob,
+                 std::vector<unsigned char> & voxels ) const;
+
+    /**
+     * Compresses a brick.
+     * @param voxels the voxels of a brick.
+     * @param[out] blob the compressed brick.
+     */
+    void encode( const std::vector<unsigned char> & voxels,
+                 std::vector<unsigned char> & blob ) const;
+
+    /**
+     * Reads and uncompresses some bricks, several bricks being
+     * uncompressed in parallel when OpenMP is enabled. The function @a
+     * visit is then called, sequentially, with each brick index and
+     * its voxels.
+     *
+     * @tparam TVisitor the type of a function (std::size_t, std::vector<unsigned char> &).
+     * @param indices the indices of the bricks.
+     * @param visit the function called for each brick.
+     */
+    template <typename TVisitor>
+    void visitBricks( const std::vector<std::size_t> & indices, TVisitor & visit ) const;
+
+    /**
+     * @param codec a compression scheme.
+     * @return the name of @a codec in the header.
+     */
+    static std::string codecName( Codec codec );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file, or NULL.
+    FILE * myFile;
+    /// Tells if bricks can be written.
+    bool myWritable;
+    /// First voxel.
+    Coordinates myLower;
+    /// Size of the volume.
+    Coordinates mySize;
+    /// Size of the bricks.
+    Coordinates myBrick;
+    /// Number of bricks along each axis.
+    Coordinates myGrid;
+    /// Compression scheme.
+    Codec myCodec;
+    /// Position of the brick index in the file.
+    DGtal::uint64_t myIndexOffset;
+    /// Position of the end of the file.
+    DGtal::uint64_t myEnd;
+    /// Positions of the bricks in the file.
+    std::vector<DGtal::uint64_t> myOffsets;
+    /// Compressed sizes of the bricks.
+    std::vector<DGtal::uint64_t> mySizes;
+    /// Space reserved in the file for each brick (at least its size).
+    std::vector<DGtal::uint64_t> myCapacities;
+    /// Free extents of the file: offset -> length.
+    std::map<DGtal::uint64_t, DGtal::uint64_t> myFreeSpace;
+    /// Serializes the accesses to the file.
+    mutable std::mutex myMutex;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Computes myGrid and resizes the index.
+    void initGrid();
+
+    /// Computes the capacities and the free extents from the index.
+    void initFreeSpace();
+
+    /**
+     * @param size a number of bytes.
+     * @return the offset of a free extent of @a size bytes, now used.
+     */
+    DGtal::uint64_t allocateSpace( DGtal::uint64_t size );
+
+    /**
+     * Adds an extent to the free ones.
+     * @param offset the first byte of the extent.
+     * @param size the length of the extent.
+     */
+    void releaseSpace( DGtal::uint64_t offset, DGtal::uint64_t size );
+
+  }; // end of class BrickVolFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BrickVolFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BrickVolFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const BrickVolFile & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BrickVolFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolFile_h
+
+#undef BrickVolFile_RECURSES
+#endif // else defined(BrickVolFile_RECURSES)
@@ -44,6 +44,8 @@
 #include "DGtal/base/Common.h"
 
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 
@@ -213,6 +215,16 @@ static void draw( DGtal::Board2D & board, const DGtal::DigitalSetBySTLSet<Domain
 template<typename Domain, typename Container>
 static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByAssociativeContainer<Domain,Container> & );
 // DigitalSetByAssociativeContainer
+
+// DigitalSetByBitset
+template<typename Domain>
+static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByBitset<Domain> & );
+// DigitalSetByBitset
+
+// DigitalSetByOpenAddressing
+template<typename Domain, typename Hash>
+static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & );
+// DigitalSetByOpenAddressing
    
     
 // DigitalSetBySTLVector
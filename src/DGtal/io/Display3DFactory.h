@@ -70,6 +70,8 @@
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.h"
 
 //
 //////////////////////////////////////////////////////////////////////////////
@@ -276,6 +278,92 @@ namespace DGtal
     static void draw( Display & display, const DGtal::DigitalSetByAssociativeContainer<Domain, Container> & anObject );
     // DigitalSetByAssociativeContainer
 
+    // DigitalSetByBitset
+    /**
+     * @brief defaultStyle
+     * @param str the name of the class
+     * @param anObject the object to draw
+     * @return the dyn. alloc. default style for this object.
+     */
+    template<typename Domain>
+    static DGtal::DrawableWithDisplay3D * defaultStyle( std::string str, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief drawAsPavingTransparent
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsPavingTransparent( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief drawAsPaving
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsPaving( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief drawAsGrid
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsGrid( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief draw
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void draw( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+    // DigitalSetByBitset
+
+    // DigitalSetByOpenAddressing
+    /**
+     * @brief defaultStyle
+     * @param str the name of the class
+     * @param anObject the object to draw
+     * @return the dyn. alloc. default style for this object.
+     */
+    template<typename Domain, typename Hash>
+    static DGtal::DrawableWithDisplay3D * defaultStyle( std::string str, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & anObject );
+
+    /**
+     * @brief drawAsPavingTransparent
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsPavingTransparent( Display & display, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & anObject );
+
+    /**
+     * @brief drawAsPaving
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsPaving( Display & display, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & anObject );
+
+    /**
+     * @brief drawAsGrid
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsGrid( Display & display, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & anObject );
+
+    /**
+     * @brief draw
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain, typename Hash>
+    static void draw( Display & display, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & anObject );
+    // DigitalSetByOpenAddressing
+
     
     // DigitalSetBySTLSet
     /**
@@ -50,6 +50,8 @@
 #include "DGtal/geometry/curves/Naive3DDSSComputer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
@@ -334,6 +336,102 @@ namespace DGtal
   draw( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByAssociativeContainer<Domain, Container> & aSet );
   // DigitalSetByAssociativeContainer
 
+    // DigitalSetByBitset
+  /**
+   * Default drawing style object.
+   * @param str the name of the class
+   * @param aSet the set to draw
+   * @return the dyn. alloc. default style for this object.
+   */
+  template<typename Domain>
+  static DGtal::DrawableWithBoard3DTo2D *
+  defaultStyle( std::string str, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+  /**
+   * @brief drawAsPavingTransparent
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain>
+  static void
+  drawAsPavingTransparent( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+  /**
+   * @brief drawAsPaving
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain>
+  static void
+  drawAsPaving( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+  /**
+   * @brief drawAsGrid
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain>
+  static void
+  drawAsGrid( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+  /**
+   * @brief draw
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain>
+  static void
+  draw( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByBitset<Domain> & aSet );
+  // DigitalSetByBitset
+
+    // DigitalSetByOpenAddressing
+  /**
+   * Default drawing style object.
+   * @param str the name of the class
+   * @param aSet the set to draw
+   * @return the dyn. alloc. default style for this object.
+   */
+  template<typename Domain, typename Hash>
+  static DGtal::DrawableWithBoard3DTo2D *
+  defaultStyle( std::string str, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+  /**
+   * @brief drawAsPavingTransparent
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain, typename Hash>
+  static void
+  drawAsPavingTransparent( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+  /**
+   * @brief drawAsPaving
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain, typename Hash>
+  static void
+  drawAsPaving( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+  /**
+   * @brief drawAsGrid
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain, typename Hash>
+  static void
+  drawAsGrid( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+  /**
+   * @brief draw
+   * @param board the board where to draw
+   * @param aSet the set to draw
+   */
+  template<typename Domain, typename Hash>
+  static void
+  draw( Board3DTo2D<Space, KSpace> & board, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+  // DigitalSetByOpenAddressing
+
 
   // DigitalSetBySTLVector
   /**
@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolReader.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BrickVolReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolReader_RECURSES)
+#error Recursive header files inclusion detected in BrickVolReader.h
+#else // defined(BrickVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolReader_RECURSES
+
+#if !defined BrickVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/BrickVolFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickVolReader
+  /**
+   * Description of template class 'BrickVolReader' <p>
+   * \brief Aim: implements methods to read a "BrickVol" file, a Vol
+   * file whose voxels are stored by independently compressed bricks
+   * (see BrickVolFile and BrickVolWriter).
+   *
+   * The bricks are uncompressed in parallel when DGtal is built with
+   * OpenMP. readBricks only uncompresses the bricks intersecting the
+   * domain of an image, which is what ImageFactoryFromBrickVol uses to
+   * let a TiledImage fetch its tiles on demand.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * Image image = BrickVolReader<Image>::importBrickVol("data.bvol");
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use.
+   *
+   * @tparam TFunctor the type of functor used in the import (by default set to functors::Cast< TImageContainer::Value>) .
+   * @see testBrickVol.cpp
+   */
+  template <typename TImageContainer,
+            typename TFunctor = functors::Cast< typename TImageContainer::Value > >
+  struct BrickVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Domain::Point Point;
+    typedef TFunctor Functor;
+
+    BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;
+
+    BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
+
+    /**
+     * Main method to import a BrickVol into an instance of the
+     * template parameter ImageContainer.
+     *
+     * @param filename the file name to import.
+     * @param aFunctor the functor used to import and cast the source
+     * image values into the type of the image container value (by
+     * default set to functors::Cast < TImageContainer::Value > .
+     *
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importBrickVol(const std::string & filename,
+                                         const Functor & aFunctor =  Functor());
+
+    /**
+     * Sets the values of the points of an image domain that lie in
+     * an open BrickVol file. Only the bricks intersecting the image
+     * domain are read.
+     *
+     * @param file an open BrickVol file.
+     * @param image the image to fill.
+     * @param aFunctor the functor used to cast the voxel values.
+     */
+    static void readBricks(const BrickVolFile & file,
+                           ImageContainer & image,
+                           const Functor & aFunctor =  Functor());
+
+  private:
+
+    /**
+     * Sets the values of the points of an image that lie in a brick,
+     * with setValue.
+     * @param image the image to fill.
+     * @param file the BrickVol file.
+     * @param i the brick index.
+     * @param voxels the brick voxels.
+     * @param aFunctor the functor applied to voxel values.
+     */
+    template <typename TImage>
+    static void fill( TImage & image, const BrickVolFile & file, std::size_t i,
+                      const std::vector<unsigned char> & voxels,
+                      const Functor & aFunctor );
+
+    /**
+     * Sets the values of the points of an image that lie in a brick,
+     * directly in its storage, row by row.
+     * @param image the image to fill.
+     * @param file the BrickVol file.
+     * @param i the brick index.
+     * @param voxels the brick voxels.
+     * @param aFunctor the functor applied to voxel values.
+     */
+    template <typename TDomain, typename TValue>
+    static void fill( ImageContainerBySTLVector<TDomain, TValue> & image,
+                      const BrickVolFile & file, std::size_t i,
+                      const std::vector<unsigned char> & voxels,
+                      const Functor & aFunctor );
+
+  }; // end of class BrickVolReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BrickVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolReader_h
+
+#undef BrickVolReader_RECURSES
+#endif // else defined(BrickVolReader_RECURSES)
@@ -48,6 +48,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -113,10 +114,35 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename,
                                         const Functor & aFunctor =  Functor());
+
+    /// Type of the images returned by mapLongvol.
+    typedef ImageContainerByMappedFile<typename ImageContainer::Domain,
+                                       DGtal::uint64_t> MappedImage;
+
+    /**
+     * Maps the voxels of an uncompressed (Version 2) Longvol file into
+     * memory, without reading them: voxels are read from the disk on
+     * demand (see ImageContainerByMappedFile). Only the domain of
+     * ImageContainer is used.
+     *
+     * @param filename the file name to map.
+     * @param mode either READ_ONLY or COPY_ON_WRITE.
+     * @return the mapped image.
+     */
+    static MappedImage mapLongvol(const std::string & filename,
+                                  detail::MappedFileRegion::Mode mode = detail::MappedFileRegion::READ_ONLY);
     
     
     
   private:
+
+    /**
+     * Reads the header of a Longvol file.
+     * @param fin the file, positioned on the first voxel on return.
+     * @param version set to the Version field of the header.
+     * @return the image domain.
+     */
+    static typename ImageContainer::Domain readHeader( FILE * fin, int & version );
     
     /**
      * Generic read word (binary mode) in little-endian mode.
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -166,6 +167,23 @@ namespace DGtal
              const Vector & extent,
              const Functor & aFunctor =  Functor());
 
+    /**
+     * Method to map a Raw (any type stored in little-endian format)
+     * into memory, without reading it: values are read from the disk
+     * on demand (see ImageContainerByMappedFile).
+     *
+     * @tparam Word pixel type, which is also the image value type.
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @param mode either READ_ONLY or COPY_ON_WRITE.
+     * @return the mapped image.
+     */
+    template <typename Word>
+    static ImageContainerByMappedFile<typename ImageContainer::Domain, Word>
+    mapRaw(const std::string & filename,
+           const Vector & extent,
+           detail::MappedFileRegion::Mode mode = detail::MappedFileRegion::READ_ONLY);
+
 
   private:
 
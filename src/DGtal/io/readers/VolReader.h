@@ -46,6 +46,8 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -63,6 +65,13 @@ namespace DGtal
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
+   * The voxel data is read by fixed-size blocks and compressed data
+   * (version 3) is inflated from them by chunks, so that the memory
+   * used besides the image does not depend on the file size. When the
+   * image container is an ImageContainerBySTLVector, the functor is
+   * applied directly to its contiguous storage; other containers are
+   * filled voxel by voxel with setValue.
+   *
    * Example usage:
    * @code
    * ...
@@ -113,10 +122,68 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /// Type of the images returned by mapVol.
+    typedef ImageContainerByMappedFile<typename ImageContainer::Domain,
+                                       unsigned char> MappedImage;
+
+    /**
+     * Maps the voxels of an uncompressed (Version 2) Vol file into
+     * memory, without reading them: voxels are read from the disk on
+     * demand (see ImageContainerByMappedFile). Only the domain of
+     * ImageContainer is used.
+     *
+     * @param filename the file name to map.
+     * @param mode either READ_ONLY or COPY_ON_WRITE.
+     * @return the mapped image.
+     */
+    static MappedImage mapVol(const std::string & filename,
+                              detail::MappedFileRegion::Mode mode = detail::MappedFileRegion::READ_ONLY);
     
   private:
 
     typedef unsigned char voxel;
+
+    /**
+     * Reads the header of a Vol file.
+     * @param fin the file, positioned on the first voxel on return.
+     * @param version set to the Version field of the header.
+     * @return the image domain.
+     */
+    static typename ImageContainer::Domain readHeader( FILE * fin, int & version );
+
+    /**
+     * Sets the values of the next voxels of an image, with setValue.
+     * @param image the image to fill.
+     * @param it the position of the first voxel, updated.
+     * @param offset the index of the first voxel (unused).
+     * @param data the voxel values.
+     * @param nb the number of voxels.
+     * @param aFunctor the functor applied to voxel values.
+     */
+    template <typename TImage>
+    static void fill( TImage & image,
+                      typename TImage::Domain::ConstIterator & it,
+                      std::size_t offset,
+                      const voxel * data, std::size_t nb,
+                      const Functor & aFunctor );
+
+    /**
+     * Sets the values of the next voxels of an image, directly in
+     * its storage.
+     * @param image the image to fill.
+     * @param it the position of the first voxel (unused).
+     * @param offset the index of the first voxel.
+     * @param data the voxel values.
+     * @param nb the number of voxels.
+     * @param aFunctor the functor applied to voxel values.
+     */
+    template <typename TDomain, typename TValue>
+    static void fill( ImageContainerBySTLVector<TDomain, TValue> & image,
+                      typename TDomain::ConstIterator & it,
+                      std::size_t offset,
+                      const voxel * data, std::size_t nb,
+                      const Functor & aFunctor );
     /**
      * This class help us to associate a field type and his value.
      * An object is a pair (type, value). You can copy and assign
@@ -51,6 +51,8 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/Object.h"
@@ -314,6 +316,92 @@ namespace DGtal
     static void draw( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByAssociativeContainer<Domain, Container> & aSet );
     // DigitalSetByAssociativeContainer
 
+    // DigitalSetByBitset
+    /**
+     * Return the default drawing style object.
+     * @param str the name of the class
+     * @param aSet the set to draw
+     * @return the dyn. alloc. default style for this object.
+     */
+    template<typename Domain>
+    static DGtal::DrawableWithViewer3D * defaultStyle( std::string str, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+    /**
+     * Method to draw DigitalSetByBitset as Paving Transparent.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain>
+    static void drawAsPavingTransparent( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+    /**
+     * Method to draw DigitalSetByBitset as Paving.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain>
+    static void drawAsPaving( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+    /**
+     * Method to draw DigitalSetByBitset as Grid.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain>
+    static void drawAsGrid( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByBitset<Domain> & aSet );
+
+    /**
+     * Method to draw DigitalSetByBitset.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain>
+    static void draw( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByBitset<Domain> & aSet );
+    // DigitalSetByBitset
+
+    // DigitalSetByOpenAddressing
+    /**
+     * Return the default drawing style object.
+     * @param str the name of the class
+     * @param aSet the set to draw
+     * @return the dyn. alloc. default style for this object.
+     */
+    template<typename Domain, typename Hash>
+    static DGtal::DrawableWithViewer3D * defaultStyle( std::string str, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+    /**
+     * Method to draw DigitalSetByOpenAddressing as Paving Transparent.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsPavingTransparent( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+    /**
+     * Method to draw DigitalSetByOpenAddressing as Paving.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsPaving( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+    /**
+     * Method to draw DigitalSetByOpenAddressing as Grid.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain, typename Hash>
+    static void drawAsGrid( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+
+    /**
+     * Method to draw DigitalSetByOpenAddressing.
+     * @param viewer the viewer where to draw
+     * @param aSet the set to draw
+     */
+    template<typename Domain, typename Hash>
+    static void draw( Viewer3D<Space,KSpace> & viewer, const DGtal::DigitalSetByOpenAddressing<Domain, Hash> & aSet );
+    // DigitalSetByOpenAddressing
+
 
     // DigitalSetBySTLVector
     /**
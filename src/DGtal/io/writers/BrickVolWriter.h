@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BrickVolWriter.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module BrickVolWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BrickVolWriter_RECURSES)
+#error Recursive header files inclusion detected in BrickVolWriter.h
+#else // defined(BrickVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BrickVolWriter_RECURSES
+
+#if !defined BrickVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BrickVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/BrickVolFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BrickVolWriter
+  /**
+   * Description of template struct 'BrickVolWriter' <p>
+   * \brief Aim: Export a 3D Image using the BrickVol format, where
+   * the volume is cut into bricks that are compressed independently
+   * (see BrickVolFile), so that any brick can be read alone.
+   *
+   * Bricks are compressed in parallel when DGtal is built with
+   * OpenMP. A functor can be specified to convert image values to
+   * voxel values (unsigned char).
+   *
+   * @tparam TImage the Image type.
+   * @tparam TFunctor the type of functor used in the export.
+   * @see testBrickVol.cpp
+   */
+  template <typename TImage, typename TFunctor = functors::Identity>
+  struct BrickVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef typename TImage::Domain::Point Point;
+    typedef TFunctor Functor;
+
+    BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, Value, unsigned char> )) ;
+    BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
+
+    /**
+     * Export an Image with the BrickVol format.
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param brickSize the size of the (cubic) bricks
+     * @param codec the compression scheme of the bricks
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportBrickVol(const std::string & filename, const Image & aImage,
+                               const unsigned int brickSize = 64,
+                               const BrickVolFile::Codec codec = BrickVolFile::ZLIB,
+                               const Functor & aFunctor = Functor());
+
+    /**
+     * Writes the values of an image in the bricks of a writable
+     * BrickVol file. Bricks only partly covered by the image domain
+     * are read and updated.
+     *
+     * @param file a writable BrickVol file.
+     * @param aImage the image to write.
+     * @param aFunctor functor used to cast image values
+     */
+    static void writeBricks(BrickVolFile & file, const Image & aImage,
+                            const Functor & aFunctor = Functor());
+  };
+}//namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BrickVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BrickVolWriter_h
+
+#undef BrickVolWriter_RECURSES
+#endif // else defined(BrickVolWriter_RECURSES)
@@ -54,6 +54,7 @@
 #include "DGtal/base/CBidirectionalRange.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CEuclideanRing.h"
+#include "DGtal/kernel/PointVectorArithmetic.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -803,6 +804,9 @@ namespace DGtal
     ///Internal data-structure: std::array with constant size.
     Container myArray;
 
+    /// Component-wise arithmetic on the container (unrolled in 2D/3D).
+    typedef detail::PointVectorArithmetic<dim, Component, Container> Arithmetic;
+
   }; // end of class PointVector
 
   /// Operator <<
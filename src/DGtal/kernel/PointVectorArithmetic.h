@@ -0,0 +1,405 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointVectorArithmetic.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PointVectorArithmetic.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointVectorArithmetic_RECURSES)
+#error Recursive header files inclusion detected in PointVectorArithmetic.h
+#else // defined(PointVectorArithmetic_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointVectorArithmetic_RECURSES
+
+#if !defined PointVectorArithmetic_h
+/** Prevents repeated inclusion of headers. */
+#define PointVectorArithmetic_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class PointVectorArithmetic
+    /**
+     * Description of template class 'PointVectorArithmetic' <p>
+     * \brief Aim: component-wise arithmetic used by PointVector on its
+     * container.
+     *
+     * The generic version loops over the components. It is
+     * specialized for std::array containers of dimension 2 and 3
+     * (fully unrolled code, which compilers vectorize for integer
+     * components), and, when SSE2 is available, for double components
+     * (explicitly packed lane-wise operations). All versions
+     * evaluate the components with the same operations in the same
+     * order, so that they give exactly the same results.
+     *
+     * Conventions: inf/sup follow std::min/std::max of (a[i], b[i]),
+     * dot products and squared norms accumulate from zero in increasing
+     * dimension order.
+     *
+     * @tparam dim the dimension.
+     * @tparam TComponent the component type.
+     * @tparam TContainer the container of the components.
+     */
+    template < Dimension dim, typename TComponent, typename TContainer >
+    struct PointVectorArithmetic
+    {
+      typedef TComponent Component;
+      typedef TContainer Container;
+
+      /// a[i] += b[i]
+      static inline void addTo( Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i ) a[ i ] += b[ i ];
+      }
+
+      /// a[i] -= b[i]
+      static inline void subTo( Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i ) a[ i ] -= b[ i ];
+      }
+
+      /// a[i] *= c
+      static inline void scale( Container & a, const Component c )
+      {
+        for ( Dimension i = 0; i < dim; ++i ) a[ i ] *= c;
+      }
+
+      /// a[i] = -a[i]
+      static inline void negate( Container & a )
+      {
+        for ( Dimension i = 0; i < dim; ++i ) a[ i ] = - a[ i ];
+      }
+
+      /// a[i] = min( a[i], b[i] )
+      static inline void infWith( Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          if ( b[ i ] < a[ i ] ) a[ i ] = b[ i ];
+      }
+
+      /// a[i] = max( a[i], b[i] )
+      static inline void supWith( Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          if ( a[ i ] < b[ i ] ) a[ i ] = b[ i ];
+      }
+
+      /// @return the dot product of a and b.
+      static inline Component dot( const Container & a, const Container & b )
+      {
+        Component r = NumberTraits<Component>::ZERO;
+        for ( Dimension i = 0; i < dim; ++i ) r += a[ i ] * b[ i ];
+        return r;
+      }
+
+      /// @return the squared Euclidean norm of a, in double.
+      static inline double squaredNorm( const Container & a )
+      {
+        double r = 0.0;
+        for ( Dimension i = 0; i < dim; ++i )
+          {
+            const double x = NumberTraits<Component>::castToDouble( a[ i ] );
+            r += x * x;
+          }
+        return r;
+      }
+
+      /// @return 'true' iff a[i] <= b[i] for all i.
+      static inline bool isLower( const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          if ( b[ i ] < a[ i ] ) return false;
+        return true;
+      }
+
+      /// c[i] = a[i+1] b[i+2] - a[i+2] b[i+1] (indices modulo dim)
+      static inline void crossProduct( Container & c, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          c[ i ] = a[ (i+1)%dim ] * b[ (i+2)%dim ] - a[ (i+2)%dim ] * b[ (i+1)%dim ];
+      }
+    }; // end of struct PointVectorArithmetic
+
+    /// Unrolled arithmetic of 2D points stored in std::array.
+    template < typename TComponent >
+    struct PointVectorArithmetic< 2, TComponent, std::array<TComponent, 2> >
+    {
+      typedef TComponent Component;
+      typedef std::array<TComponent, 2> Container;
+
+      static inline void addTo( Container & a, const Container & b )
+      { a[ 0 ] += b[ 0 ]; a[ 1 ] += b[ 1 ]; }
+
+      static inline void subTo( Container & a, const Container & b )
+      { a[ 0 ] -= b[ 0 ]; a[ 1 ] -= b[ 1 ]; }
+
+      static inline void scale( Container & a, const Component c )
+      { a[ 0 ] *= c; a[ 1 ] *= c; }
+
+      static inline void negate( Container & a )
+      { a[ 0 ] = - a[ 0 ]; a[ 1 ] = - a[ 1 ]; }
+
+      static inline void infWith( Container & a, const Container & b )
+      {
+        a[ 0 ] = ( b[ 0 ] < a[ 0 ] ) ? b[ 0 ] : a[ 0 ];
+        a[ 1 ] = ( b[ 1 ] < a[ 1 ] ) ? b[ 1 ] : a[ 1 ];
+      }
+
+      static inline void supWith( Container & a, const Container & b )
+      {
+        a[ 0 ] = ( a[ 0 ] < b[ 0 ] ) ? b[ 0 ] : a[ 0 ];
+        a[ 1 ] = ( a[ 1 ] < b[ 1 ] ) ? b[ 1 ] : a[ 1 ];
+      }
+
+      static inline Component dot( const Container & a, const Container & b )
+      {
+        return ( NumberTraits<Component>::ZERO + a[ 0 ] * b[ 0 ] ) + a[ 1 ] * b[ 1 ];
+      }
+
+      static inline double squaredNorm( const Container & a )
+      {
+        const double x = NumberTraits<Component>::castToDouble( a[ 0 ] );
+        const double y = NumberTraits<Component>::castToDouble( a[ 1 ] );
+        return ( 0.0 + x * x ) + y * y;
+      }
+
+      static inline bool isLower( const Container & a, const Container & b )
+      {
+        return ( ! ( b[ 0 ] < a[ 0 ] ) ) & ( ! ( b[ 1 ] < a[ 1 ] ) );
+      }
+
+      static inline void crossProduct( Container & c, const Container & a, const Container & b )
+      {
+        c[ 0 ] = a[ 1 ] * b[ 0 ] - a[ 0 ] * b[ 1 ];
+        c[ 1 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+      }
+    }; // end of struct PointVectorArithmetic<2>
+
+    /// Unrolled arithmetic of 3D points stored in std::array.
+    template < typename TComponent >
+    struct PointVectorArithmetic< 3, TComponent, std::array<TComponent, 3> >
+    {
+      typedef TComponent Component;
+      typedef std::array<TComponent, 3> Container;
+
+      static inline void addTo( Container & a, const Container & b )
+      { a[ 0 ] += b[ 0 ]; a[ 1 ] += b[ 1 ]; a[ 2 ] += b[ 2 ]; }
+
+      static inline void subTo( Container & a, const Container & b )
+      { a[ 0 ] -= b[ 0 ]; a[ 1 ] -= b[ 1 ]; a[ 2 ] -= b[ 2 ]; }
+
+      static inline void scale( Container & a, const Component c )
+      { a[ 0 ] *= c; a[ 1 ] *= c; a[ 2 ] *= c; }
+
+      static inline void negate( Container & a )
+      { a[ 0 ] = - a[ 0 ]; a[ 1 ] = - a[ 1 ]; a[ 2 ] = - a[ 2 ]; }
+
+      static inline void infWith( Container & a, const Container & b )
+      {
+        a[ 0 ] = ( b[ 0 ] < a[ 0 ] ) ? b[ 0 ] : a[ 0 ];
+        a[ 1 ] = ( b[ 1 ] < a[ 1 ] ) ? b[ 1 ] : a[ 1 ];
+        a[ 2 ] = ( b[ 2 ] < a[ 2 ] ) ? b[ 2 ] : a[ 2 ];
+      }
+
+      static inline void supWith( Container & a, const Container & b )
+      {
+        a[ 0 ] = ( a[ 0 ] < b[ 0 ] ) ? b[ 0 ] : a[ 0 ];
+        a[ 1 ] = ( a[ 1 ] < b[ 1 ] ) ? b[ 1 ] : a[ 1 ];
+        a[ 2 ] = ( a[ 2 ] < b[ 2 ] ) ? b[ 2 ] : a[ 2 ];
+      }
+
+      static inline Component dot( const Container & a, const Container & b )
+      {
+        return ( ( NumberTraits<Component>::ZERO + a[ 0 ] * b[ 0 ] )
+                 + a[ 1 ] * b[ 1 ] ) + a[ 2 ] * b[ 2 ];
+      }
+
+      static inline double squaredNorm( const Container & a )
+      {
+        const double x = NumberTraits<Component>::castToDouble( a[ 0 ] );
+        const double y = NumberTraits<Component>::castToDouble( a[ 1 ] );
+        const double z = NumberTraits<Component>::castToDouble( a[ 2 ] );
+        return ( ( 0.0 + x * x ) + y * y ) + z * z;
+      }
+
+      static inline bool isLower( const Container & a, const Container & b )
+      {
+        return ( ! ( b[ 0 ] < a[ 0 ] ) ) & ( ! ( b[ 1 ] < a[ 1 ] ) )
+          & ( ! ( b[ 2 ] < a[ 2 ] ) );
+      }
+
+      /// c = a x b
+      static inline void crossProduct( Container & c, const Container & a, const Container & b )
+      {
+        c[ 0 ] = a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+        c[ 1 ] = a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+        c[ 2 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+      }
+    }; // end of struct PointVectorArithmetic<3>
+
+#if defined(__SSE2__)
+    /**
+     * Packed SSE2 versions of the lane-wise operations of double
+     * points: the two first components go in one 128-bit register.
+     * min/max operands are swapped to match std::min/std::max on
+     * equal or unordered values.
+     */
+    struct PointVectorArithmeticSSE2Double
+    {
+      static inline void addTo( double * a, const double * b )
+      { _mm_storeu_pd( a, _mm_add_pd( _mm_loadu_pd( a ), _mm_loadu_pd( b ) ) ); }
+
+      static inline void subTo( double * a, const double * b )
+      { _mm_storeu_pd( a, _mm_sub_pd( _mm_loadu_pd( a ), _mm_loadu_pd( b ) ) ); }
+
+      static inline void scale( double * a, const double c )
+      { _mm_storeu_pd( a, _mm_mul_pd( _mm_loadu_pd( a ), _mm_set1_pd( c ) ) ); }
+
+      static inline void negate( double * a )
+      { _mm_storeu_pd( a, _mm_xor_pd( _mm_loadu_pd( a ), _mm_set1_pd( -0.0 ) ) ); }
+
+      static inline void infWith( double * a, const double * b )
+      { _mm_storeu_pd( a, _mm_min_pd( _mm_loadu_pd( b ), _mm_loadu_pd( a ) ) ); }
+
+      static inline void supWith( double * a, const double * b )
+      { _mm_storeu_pd( a, _mm_max_pd( _mm_loadu_pd( b ), _mm_loadu_pd( a ) ) ); }
+    };
+
+    /// SSE2 arithmetic of 2D double points.
+    template <>
+    struct PointVectorArithmetic< 2, double, std::array<double, 2> >
+    {
+      typedef double Component;
+      typedef std::array<double, 2> Container;
+      typedef PointVectorArithmeticSSE2Double Packed;
+
+      static inline void addTo( Container & a, const Container & b )
+      { Packed::addTo( a.data(), b.data() ); }
+
+      static inline void subTo( Container & a, const Container & b )
+      { Packed::subTo( a.data(), b.data() ); }
+
+      static inline void scale( Container & a, const Component c )
+      { Packed::scale( a.data(), c ); }
+
+      static inline void negate( Container & a )
+      { Packed::negate( a.data() ); }
+
+      static inline void infWith( Container & a, const Container & b )
+      { Packed::infWith( a.data(), b.data() ); }
+
+      static inline void supWith( Container & a, const Container & b )
+      { Packed::supWith( a.data(), b.data() ); }
+
+      static inline Component dot( const Container & a, const Container & b )
+      { return ( 0.0 + a[ 0 ] * b[ 0 ] ) + a[ 1 ] * b[ 1 ]; }
+
+      static inline double squaredNorm( const Container & a )
+      { return ( 0.0 + a[ 0 ] * a[ 0 ] ) + a[ 1 ] * a[ 1 ]; }
+
+      static inline bool isLower( const Container & a, const Container & b )
+      { return ( ! ( b[ 0 ] < a[ 0 ] ) ) & ( ! ( b[ 1 ] < a[ 1 ] ) ); }
+
+      static inline void crossProduct( Container & c, const Container & a, const Container & b )
+      {
+        c[ 0 ] = a[ 1 ] * b[ 0 ] - a[ 0 ] * b[ 1 ];
+        c[ 1 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+      }
+    };
+
+    /// SSE2 arithmetic of 3D double points (two packed lanes plus one).
+    template <>
+    struct PointVectorArithmetic< 3, double, std::array<double, 3> >
+    {
+      typedef double Component;
+      typedef std::array<double, 3> Container;
+      typedef PointVectorArithmeticSSE2Double Packed;
+
+      static inline void addTo( Container & a, const Container & b )
+      { Packed::addTo( a.data(), b.data() ); a[ 2 ] += b[ 2 ]; }
+
+      static inline void subTo( Container & a, const Container & b )
+      { Packed::subTo( a.data(), b.data() ); a[ 2 ] -= b[ 2 ]; }
+
+      static inline void scale( Container & a, const Component c )
+      { Packed::scale( a.data(), c ); a[ 2 ] *= c; }
+
+      static inline void negate( Container & a )
+      { Packed::negate( a.data() ); a[ 2 ] = - a[ 2 ]; }
+
+      static inline void infWith( Container & a, const Container & b )
+      {
+        Packed::infWith( a.data(), b.data() );
+        a[ 2 ] = ( b[ 2 ] < a[ 2 ] ) ? b[ 2 ] : a[ 2 ];
+      }
+
+      static inline void supWith( Container & a, const Container & b )
+      {
+        Packed::supWith( a.data(), b.data() );
+        a[ 2 ] = ( a[ 2 ] < b[ 2 ] ) ? b[ 2 ] : a[ 2 ];
+      }
+
+      static inline Component dot( const Container & a, const Container & b )
+      { return ( ( 0.0 + a[ 0 ] * b[ 0 ] ) + a[ 1 ] * b[ 1 ] ) + a[ 2 ] * b[ 2 ]; }
+
+      static inline double squaredNorm( const Container & a )
+      { return ( ( 0.0 + a[ 0 ] * a[ 0 ] ) + a[ 1 ] * a[ 1 ] ) + a[ 2 ] * a[ 2 ]; }
+
+      static inline bool isLower( const Container & a, const Container & b )
+      {
+        return ( ! ( b[ 0 ] < a[ 0 ] ) ) & ( ! ( b[ 1 ] < a[ 1 ] ) )
+          & ( ! ( b[ 2 ] < a[ 2 ] ) );
+      }
+
+      static inline void crossProduct( Container & c, const Container & a, const Container & b )
+      {
+        c[ 0 ] = a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+        c[ 1 ] = a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+        c[ 2 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+      }
+    };
+#endif // defined(__SSE2__)
+
+  } // namespace detail
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointVectorArithmetic_h
+
+#undef PointVectorArithmetic_RECURSES
+#endif // else defined(PointVectorArithmetic_RECURSES)
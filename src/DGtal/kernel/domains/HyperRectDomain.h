@@ -117,6 +117,7 @@ namespace DGtal
     typedef myreverse_iterator<Iterator> ReverseIterator;
     typedef Iterator ConstIterator;
     typedef ReverseIterator ConstReverseIterator;
+    typedef HyperRectDomain_SplitRange<ConstIterator> ConstSplitRange;
     
     typedef functors::IsWithinPointPredicate<Point> Predicate;
 
@@ -222,6 +223,19 @@ namespace DGtal
       { 
         return ConstReverseIterator(begin());
       }
+
+    /**
+     * Splits the domain scan into contiguous parts of balanced sizes,
+     * e.g. to process them in parallel without copying the points.
+     * Iterators are random-access, so a part can also be obtained
+     * directly as [begin() + i, begin() + j).
+     * @param nbParts the number of parts (at least one).
+     * @return the parts, in the scan order.
+     */
+    std::vector<ConstSplitRange> split( std::size_t nbParts ) const
+      {
+        return ConstSplitRange::split( begin(), end(), nbParts );
+      }
     
     /**
      * Description of class 'ConstSubRange' <p> \brief Aim:
@@ -235,6 +249,7 @@ namespace DGtal
     {
       typedef HyperRectDomain_subIterator<Point> ConstIterator;
       typedef myreverse_iterator<ConstIterator> ConstReverseIterator;
+      typedef HyperRectDomain_SplitRange<ConstIterator> ConstSplitRange;
 
       /**
        * ConstSubRange constructor from a given domain.
@@ -437,6 +452,17 @@ namespace DGtal
           return ConstReverseIterator(begin());
         }
 
+      /**
+       * Splits the sub-range into contiguous parts of balanced sizes,
+       * e.g. to process them in parallel without copying the points.
+       * @param nbParts the number of parts (at least one).
+       * @return the parts, in the scan order.
+       */
+      std::vector<ConstSplitRange> split( std::size_t nbParts ) const
+        {
+          return ConstSplitRange::split( begin(), end(), nbParts );
+        }
+
     private:
       /// Lower bound of the subrange.
       Point                  myLowerBound;
@@ -131,7 +131,10 @@ public:
     return *this;
   }
 
-  reference operator[](difference_type __n) const
+  // Returned by value since operator* refers to a member of the
+  // temporary iterator.
+  typename std::iterator_traits<_Iterator>::value_type
+  operator[](difference_type __n) const
   { return *(*this + __n); }
 };
 template<typename _Iterator>
@@ -144,6 +147,31 @@ inline bool
     operator!=(const myreverse_iterator<_Iterator>& __x,
                const myreverse_iterator<_Iterator>& __y)
 { return !(__x == __y); }
+template<typename _Iterator>
+inline typename myreverse_iterator<_Iterator>::difference_type
+    operator-(const myreverse_iterator<_Iterator>& __x,
+              const myreverse_iterator<_Iterator>& __y)
+{ return __y.base() - __x.base(); }
+template<typename _Iterator>
+inline bool
+    operator<(const myreverse_iterator<_Iterator>& __x,
+              const myreverse_iterator<_Iterator>& __y)
+{ return __y.base() < __x.base(); }
+template<typename _Iterator>
+inline bool
+    operator>(const myreverse_iterator<_Iterator>& __x,
+              const myreverse_iterator<_Iterator>& __y)
+{ return __y < __x; }
+template<typename _Iterator>
+inline bool
+    operator<=(const myreverse_iterator<_Iterator>& __x,
+               const myreverse_iterator<_Iterator>& __y)
+{ return !(__y < __x); }
+template<typename _Iterator>
+inline bool
+    operator>=(const myreverse_iterator<_Iterator>& __x,
+               const myreverse_iterator<_Iterator>& __y)
+{ return !(__x < __y); }
 
 //******************************************************************************
 namespace DGtal
@@ -158,7 +186,7 @@ namespace DGtal
   class HyperRectDomain_Iterator
   {
   public:
-    typedef std::bidirectional_iterator_tag iterator_category; ///\todo construct a RANDOM-ACCESS iterator
+    typedef std::random_access_iterator_tag iterator_category;
     typedef TPoint value_type;
     typedef ptrdiff_t difference_type;
     typedef TPoint* pointer;
@@ -304,6 +332,131 @@ namespace DGtal
         return tmp;
       }
 
+    /**
+     * Rank of the current point in the domain scan, i.e. its index
+     * in the column-major order of Linearizer. The end iterator has
+     * the size of the domain as rank.
+     * @return the rank of the current point.
+     */
+    difference_type linearIndex() const
+      {
+        difference_type index = 0;
+        difference_type stride = 1;
+        for ( Dimension k = 0; k < TPoint::dimension; ++k )
+          {
+            index  += static_cast<difference_type>( myPoint[k] - mylower[k] ) * stride;
+            stride *= static_cast<difference_type>( myupper[k] - mylower[k] + 1 );
+          }
+        return index;
+      }
+
+    /**
+     * Moves the iterator to the point of given rank in the domain scan.
+     * @param index a rank between 0 and the size of the domain (end).
+     */
+    void setLinearIndex( difference_type index )
+      {
+        ASSERT( index >= 0 );
+        for ( Dimension k = 0; k + 1 < TPoint::dimension; ++k )
+          {
+            const difference_type extent = static_cast<difference_type>( myupper[k] - mylower[k] + 1 );
+            myPoint[k] = mylower[k] + static_cast<typename TPoint::Coordinate>( index % extent );
+            index /= extent;
+          }
+        // The last coordinate is not wrapped so that the domain size gives end().
+        myPoint[ TPoint::dimension - 1 ] = mylower[ TPoint::dimension - 1 ]
+          + static_cast<typename TPoint::Coordinate>( index );
+      }
+
+    /**
+     * Operator += (it += n), in constant time with respect to n.
+     */
+    HyperRectDomain_Iterator<TPoint> & operator+= ( difference_type n )
+      {
+        if ( n != 0 )
+          setLinearIndex( linearIndex() + n );
+        return *this;
+      }
+
+    /**
+     * Operator -= (it -= n), in constant time with respect to n.
+     */
+    HyperRectDomain_Iterator<TPoint> & operator-= ( difference_type n )
+      {
+        return operator+=( -n );
+      }
+
+    /**
+     * Operator + (it + n)
+     */
+    HyperRectDomain_Iterator<TPoint> operator+ ( difference_type n ) const
+      {
+        HyperRectDomain_Iterator<TPoint> tmp = *this;
+        return tmp += n;
+      }
+
+    /**
+     * Operator - (it - n)
+     */
+    HyperRectDomain_Iterator<TPoint> operator- ( difference_type n ) const
+      {
+        HyperRectDomain_Iterator<TPoint> tmp = *this;
+        return tmp -= n;
+      }
+
+    /**
+     * Distance between two iterators of the same domain.
+     */
+    difference_type operator- ( const HyperRectDomain_Iterator<TPoint> & aIt ) const
+      {
+        return linearIndex() - aIt.linearIndex();
+      }
+
+    /**
+     * Operator [] (it[n]). The point is returned by value since the
+     * temporary iterator owns it.
+     */
+    TPoint operator[] ( difference_type n ) const
+      {
+        return *( *this + n );
+      }
+
+    /**
+     * Operator < : compares the positions of two iterators of the same
+     * domain in the scan.
+     */
+    bool operator< ( const HyperRectDomain_Iterator<TPoint> & aIt ) const
+      {
+        for ( Dimension k = TPoint::dimension; k-- > 0; )
+          if ( myPoint[k] != aIt.myPoint[k] )
+            return myPoint[k] < aIt.myPoint[k];
+        return false;
+      }
+
+    /**
+     * Operator >
+     */
+    bool operator> ( const HyperRectDomain_Iterator<TPoint> & aIt ) const
+      {
+        return aIt < *this;
+      }
+
+    /**
+     * Operator <=
+     */
+    bool operator<= ( const HyperRectDomain_Iterator<TPoint> & aIt ) const
+      {
+        return !( aIt < *this );
+      }
+
+    /**
+     * Operator >=
+     */
+    bool operator>= ( const HyperRectDomain_Iterator<TPoint> & aIt ) const
+      {
+        return !( *this < aIt );
+      }
+
   private:
     ///Current Point in the domain
     TPoint myPoint;
@@ -321,7 +474,7 @@ namespace DGtal
   class HyperRectDomain_subIterator
   {
   public:
-    typedef std::bidirectional_iterator_tag iterator_category; ///\todo construct a RANDOM-ACCESS iterator
+    typedef std::random_access_iterator_tag iterator_category;
     typedef TPoint value_type;
     typedef ptrdiff_t difference_type;
     typedef TPoint* pointer;
@@ -536,6 +689,138 @@ namespace DGtal
         return tmp;
       }
 
+    /**
+     * Rank of the current point in the sub-range scan, computed as in
+     * Linearizer with the dimensions taken in the sub-range order. The
+     * end iterator has the size of the sub-range as rank.
+     * @return the rank of the current point.
+     */
+    difference_type linearIndex() const
+      {
+        difference_type index = 0;
+        difference_type stride = 1;
+        for ( Dimension k = 0; k < mySubDomain.size(); ++k )
+          {
+            const Dimension d = mySubDomain[k];
+            index  += static_cast<difference_type>( myPoint[d] - mylower[d] ) * stride;
+            stride *= static_cast<difference_type>( myupper[d] - mylower[d] + 1 );
+          }
+        return index;
+      }
+
+    /**
+     * Moves the iterator to the point of given rank in the sub-range scan.
+     * @param index a rank between 0 and the size of the sub-range (end).
+     */
+    void setLinearIndex( difference_type index )
+      {
+        ASSERT( mySubDomain.size() > 0 );
+        ASSERT( index >= 0 );
+        const Dimension last = static_cast<Dimension>( mySubDomain.size() - 1 );
+        for ( Dimension k = 0; k < last; ++k )
+          {
+            const Dimension d = mySubDomain[k];
+            const difference_type extent = static_cast<difference_type>( myupper[d] - mylower[d] + 1 );
+            myPoint[d] = mylower[d] + static_cast<typename TPoint::Coordinate>( index % extent );
+            index /= extent;
+          }
+        // The last coordinate is not wrapped so that the size gives end().
+        myPoint[ mySubDomain[last] ] = mylower[ mySubDomain[last] ]
+          + static_cast<typename TPoint::Coordinate>( index );
+      }
+
+    /**
+     * Operator += (it += n), in constant time with respect to n.
+     */
+    HyperRectDomain_subIterator<TPoint> & operator+= ( difference_type n )
+      {
+        if ( n != 0 )
+          setLinearIndex( linearIndex() + n );
+        return *this;
+      }
+
+    /**
+     * Operator -= (it -= n), in constant time with respect to n.
+     */
+    HyperRectDomain_subIterator<TPoint> & operator-= ( difference_type n )
+      {
+        return operator+=( -n );
+      }
+
+    /**
+     * Operator + (it + n)
+     */
+    HyperRectDomain_subIterator<TPoint> operator+ ( difference_type n ) const
+      {
+        HyperRectDomain_subIterator<TPoint> tmp = *this;
+        return tmp += n;
+      }
+
+    /**
+     * Operator - (it - n)
+     */
+    HyperRectDomain_subIterator<TPoint> operator- ( difference_type n ) const
+      {
+        HyperRectDomain_subIterator<TPoint> tmp = *this;
+        return tmp -= n;
+      }
+
+    /**
+     * Distance between two iterators of the same sub-range.
+     */
+    difference_type operator- ( const HyperRectDomain_subIterator<TPoint> & aIt ) const
+      {
+        return linearIndex() - aIt.linearIndex();
+      }
+
+    /**
+     * Operator [] (it[n]). The point is returned by value since the
+     * temporary iterator owns it.
+     */
+    TPoint operator[] ( difference_type n ) const
+      {
+        return *( *this + n );
+      }
+
+    /**
+     * Operator < : compares the positions of two iterators of the same
+     * sub-range in the scan.
+     */
+    bool operator< ( const HyperRectDomain_subIterator<TPoint> & aIt ) const
+      {
+        for ( Dimension k = static_cast<Dimension>( mySubDomain.size() ); k-- > 0; )
+          {
+            const Dimension d = mySubDomain[k];
+            if ( myPoint[d] != aIt.myPoint[d] )
+              return myPoint[d] < aIt.myPoint[d];
+          }
+        return false;
+      }
+
+    /**
+     * Operator >
+     */
+    bool operator> ( const HyperRectDomain_subIterator<TPoint> & aIt ) const
+      {
+        return aIt < *this;
+      }
+
+    /**
+     * Operator <=
+     */
+    bool operator<= ( const HyperRectDomain_subIterator<TPoint> & aIt ) const
+      {
+        return !( aIt < *this );
+      }
+
+    /**
+     * Operator >=
+     */
+    bool operator>= ( const HyperRectDomain_subIterator<TPoint> & aIt ) const
+      {
+        return !( *this < aIt );
+      }
+
   private:
     ///Current Point in the domain
     TPoint myPoint;
@@ -546,6 +831,116 @@ namespace DGtal
     std::vector<Dimension> mySubDomain;
   }; // End of class HyperRectDomain_subIterator
 
+  /**
+   * Operator + (n + it)
+   */
+  template<typename TPoint>
+  inline
+  HyperRectDomain_Iterator<TPoint>
+  operator+ ( typename HyperRectDomain_Iterator<TPoint>::difference_type n,
+              const HyperRectDomain_Iterator<TPoint> & it )
+  {
+    return it + n;
+  }
+
+  /**
+   * Operator + (n + it)
+   */
+  template<typename TPoint>
+  inline
+  HyperRectDomain_subIterator<TPoint>
+  operator+ ( typename HyperRectDomain_subIterator<TPoint>::difference_type n,
+              const HyperRectDomain_subIterator<TPoint> & it )
+  {
+    return it + n;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HyperRectDomain_SplitRange
+  /**
+   * Description of class 'HyperRectDomain_SplitRange' <p>
+   * Aim: a contiguous part [begin,end) of the scan of a HyperRectDomain
+   * or of one of its sub-ranges, as given by their split() methods.
+   * Parts can be processed independently, e.g. one per thread.
+   *
+   * @tparam TIterator a random-access iterator on the domain points.
+   */
+  template<typename TIterator>
+  class HyperRectDomain_SplitRange
+  {
+  public:
+    typedef TIterator ConstIterator;
+    typedef typename TIterator::difference_type difference_type;
+
+    /**
+     * Constructor from the two bounding iterators.
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     */
+    HyperRectDomain_SplitRange( const TIterator & itb, const TIterator & ite )
+      : myBegin( itb ), myEnd( ite )
+      {}
+
+    /**
+     * @return an iterator on the first point of the part.
+     */
+    ConstIterator begin() const
+      {
+        return myBegin;
+      }
+
+    /**
+     * @return an iterator after the last point of the part.
+     */
+    ConstIterator end() const
+      {
+        return myEnd;
+      }
+
+    /**
+     * @return the number of points of the part.
+     */
+    difference_type size() const
+      {
+        return myEnd - myBegin;
+      }
+
+    /**
+     * Splits [itb,ite) into @a nbParts contiguous parts whose sizes
+     * differ by at most one. Some parts are empty if there are less
+     * points than parts.
+     *
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @param nbParts the number of parts (at least one).
+     * @return the parts, in the scan order.
+     */
+    static std::vector< HyperRectDomain_SplitRange<TIterator> >
+    split( const TIterator & itb, const TIterator & ite, std::size_t nbParts )
+      {
+        ASSERT( nbParts > 0 );
+        const difference_type n = ite - itb;
+        const difference_type q = n / static_cast<difference_type>( nbParts );
+        const difference_type r = n % static_cast<difference_type>( nbParts );
+        std::vector< HyperRectDomain_SplitRange<TIterator> > parts;
+        parts.reserve( nbParts );
+        TIterator it = itb;
+        for ( std::size_t k = 0; k < nbParts; ++k )
+          {
+            const TIterator first = it;
+            it += q + ( static_cast<difference_type>( k ) < r ? 1 : 0 );
+            parts.push_back( HyperRectDomain_SplitRange<TIterator>( first, it ) );
+          }
+        return parts;
+      }
+
+  private:
+    /// Begin iterator.
+    TIterator myBegin;
+    /// End iterator.
+    TIterator myEnd;
+  }; // End of class HyperRectDomain_SplitRange
+
 } //namespace
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,511 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByBitset.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+    Description of template class 'DigitalSetByBitset' <p>
+
+    \brief Aim: A dense container for storing sets of digital points
+    within some given HyperRectDomain, with one bit per point of the
+    domain.
+
+    Points are mapped to bits through the column-major Linearizer of
+    the domain, and bits are packed into 64-bit words. Hence:
+    - the memory footprint is \f$ |D|/8 \f$ bytes whatever the number
+      of points in the set;
+    - membership tests, insertions and removals are O(1) and do not
+      allocate;
+    - size() is O(1), the cardinal being maintained on insertion/removal
+      and recomputed with popcounts after word-wide operations;
+    - union (operator+=, operator|=), intersection (operator&=) and
+      difference (operator-=) of sets defined on the same domain are
+      performed word per word (loops that compilers vectorize);
+    - iteration visits points in the domain scanning order and skips
+      empty words.
+
+    It is thus well suited for big sets (BIG_DS, WHOLE_DS), and is the
+    type selected by DigitalSetSelector when BITSET_DS is given. It is not
+    adapted to small sets in very large domains, since iteration and
+    memory are proportional to the domain size.
+
+    Model of CDigitalSet.
+
+    @note Iterator and ConstIterator are the same type (as for STL
+    sets). Iterators are not invalidated by insertions or removals,
+    except for an iterator pointing on an erased point.
+
+    @tparam TDomain type of domain on which the set will be defined, a
+    HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+
+    ///Domain type.
+    typedef TDomain Domain;
+    ///Self Type.
+    typedef DigitalSetByBitset<Domain> Self;
+    ///Type of digital space.
+    typedef typename Domain::Space Space;
+    ///Type of points in the space.
+    typedef typename Domain::Point Point;
+    ///Size type.
+    typedef typename Domain::Size Size;
+    ///Value type.
+    typedef Point value_type;
+    ///Type of a word of the bitset.
+    typedef DGtal::uint64_t Word;
+    ///Type of the container storing the words.
+    typedef std::vector<Word> Container;
+    ///Linearizer used to map points to bit indices.
+    typedef Linearizer<Domain, ColMajorStorage> TheLinearizer;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+
+    /// Number of bits in a word.
+    BOOST_STATIC_CONSTANT( unsigned int, wordBits = 64 );
+
+    /**
+       Forward iterator visiting the points of the set in the
+       linearized order of the domain. It skips empty words. Iterator
+       and ConstIterator are the same type.
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator();
+
+      /**
+         Constructor from a set and a bit index. The index is moved to
+         the first set bit greater or equal to \a index.
+
+         @param aSet the set to visit.
+         @param index any bit index (at most the domain size).
+      */
+      ConstIterator( const DigitalSetByBitset & aSet, Size index );
+
+      /// @return the current point.
+      reference operator*() const;
+      /// @return a pointer on the current point.
+      pointer operator->() const;
+      /// Pre-increment.
+      /// @return a reference to itself.
+      ConstIterator & operator++();
+      /// Post-increment.
+      /// @return the iterator before incrementation.
+      ConstIterator operator++( int );
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on the same bit.
+      bool operator==( const ConstIterator & other ) const;
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on different bits.
+      bool operator!=( const ConstIterator & other ) const;
+      /// @return the linearized index of the current point.
+      Size index() const;
+
+    private:
+      /// Moves to the first set bit greater or equal to myIndex.
+      void seek();
+
+      /// The visited set.
+      const DigitalSetByBitset* mySet;
+      /// The current bit index.
+      Size myIndex;
+      /// The current point.
+      Point myPoint;
+    };
+
+    ///Iterator type (same as ConstIterator).
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitset();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitset( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset ( const DigitalSetByBitset & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set. Points outside the associated
+     * domain cannot be represented and are ignored.
+     *
+     * @param p any digital point.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Points outside the associated domain are ignored.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. Points outside the associated domain are ignored.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Points outside the associated domain are ignored.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left. Word-wide if both sets share the same domain.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator+=( const DigitalSetByBitset & aSet );
+
+    /**
+     * Set union to left (same as operator+=).
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator|=( const DigitalSetByBitset & aSet );
+
+    /**
+     * Set intersection to left. Word-wide if both sets share the same
+     * domain.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator&=( const DigitalSetByBitset & aSet );
+
+    /**
+     * Set difference to left. Word-wide if both sets share the same
+     * domain.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator-=( const DigitalSetByBitset & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this. Word-wide if both sets share the same domain.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitset & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the bit associated to \a p.
+     */
+    Size index( const Point & p ) const;
+
+    /**
+     * @param idx any bit index.
+     * @return 'true' iff the point of index \a idx belongs to this set.
+     */
+    bool test( Size idx ) const;
+
+    /**
+     * @return the words storing the bits of this set (the last word
+     * is padded with zeros).
+     */
+    const Container & words() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// Lower bound of the domain (cached for linearization).
+    Point myLowerBound;
+
+    /// Extent of the domain (cached for linearization).
+    Point myExtent;
+
+    /// Number of points of the domain, i.e. number of meaningful bits.
+    Size myNbBits;
+
+    /// The words storing the bits.
+    Container myWords;
+
+    /// The number of points in the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff \a other is defined on the same bounds, so
+     * that word-wide operations are valid.
+     */
+    bool sameLayout( const DigitalSetByBitset & other ) const;
+
+    /**
+     * Recomputes the cardinal of the set with popcounts.
+     */
+    void recount();
+
+    /**
+     * Clears the unused bits of the last word.
+     */
+    void clearPadding();
+
+    /**
+     * @param idx any bit index not greater than myNbBits.
+     * @return the smallest index of a set bit greater or equal to \a
+     * idx, or myNbBits if there is none.
+     */
+    Size nextSetBit( Size idx ) const;
+
+  }; // end of class DigitalSetByBitset
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
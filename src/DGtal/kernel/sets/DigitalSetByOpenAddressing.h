@@ -0,0 +1,497 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByOpenAddressing.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByOpenAddressing.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByOpenAddressing_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByOpenAddressing.h
+#else // defined(DigitalSetByOpenAddressing_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByOpenAddressing_RECURSES
+
+#if !defined DigitalSetByOpenAddressing_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByOpenAddressing_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByOpenAddressing
+  /**
+    Description of template class 'DigitalSetByOpenAddressing' <p>
+
+    \brief Aim: A flat hash set for storing sets of digital points
+    within some given domain, using open addressing with linear
+    probing.
+
+    Points are stored in one contiguous array of slots whose capacity
+    is a power of two, together with an array of slot states (empty,
+    full or erased). The slot of a point is given by its hash (by
+    default std::hash of PointVector, see PointHashFunctions.h),
+    scrambled by a Fibonacci multiplication. Collisions are resolved
+    by visiting the next slots. Contrary to
+    DigitalSetByAssociativeContainer with std::set or
+    std::unordered_set, no memory is allocated per point, and probing
+    is cache-friendly.
+
+    The memory footprint only depends on the number of points, not on
+    the domain, hence this set is adapted to sparse sets in large or
+    unbounded domains (e.g. sets of points tracked in large
+    KhalimskySpaceND).
+
+    Erased points leave a mark (tombstone) in their slot so that
+    iterators remain valid after erase; marks are reclaimed when the
+    table is rehashed.
+
+    Model of CDigitalSet.
+
+    @note Iterator and ConstIterator are the same type (as for STL
+    sets). Insertions may rehash the table and invalidate all
+    iterators, reserve() can be used to avoid this.
+
+    @tparam TDomain type of domain on which the set will be defined (model of concepts::CDomain).
+    @tparam THash hash functor on points (default is std::hash<Point>).
+   */
+  template <typename TDomain,
+            typename THash = std::hash< typename TDomain::Point > >
+  class DigitalSetByOpenAddressing
+  {
+  public:
+
+    ///Domain type.
+    typedef TDomain Domain;
+    ///Hash functor type.
+    typedef THash Hash;
+    ///Self Type.
+    typedef DigitalSetByOpenAddressing<Domain, Hash> Self;
+    ///Type of digital space.
+    typedef typename Domain::Space Space;
+    ///Type of points in the space.
+    typedef typename Domain::Point Point;
+    ///Size type.
+    typedef typename Domain::Size Size;
+    ///Value type.
+    typedef Point value_type;
+    ///Type for the state of a slot.
+    typedef unsigned char SlotState;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+
+    /// State of a slot that never contained a point.
+    BOOST_STATIC_CONSTANT( SlotState, EMPTY = 0 );
+    /// State of a slot containing a point.
+    BOOST_STATIC_CONSTANT( SlotState, FULL = 1 );
+    /// State of a slot whose point was erased.
+    BOOST_STATIC_CONSTANT( SlotState, ERASED = 2 );
+
+    /**
+       Forward iterator visiting the points of the set in slot
+       order. Iterator and ConstIterator are the same type.
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator();
+
+      /**
+         Constructor from a set and a slot. The iterator is moved to
+         the first full slot from \a slot.
+
+         @param aSet the set to visit.
+         @param slot any slot index (at most the capacity).
+      */
+      ConstIterator( const DigitalSetByOpenAddressing & aSet, Size slot );
+
+      /// @return the current point.
+      reference operator*() const;
+      /// @return a pointer on the current point.
+      pointer operator->() const;
+      /// Pre-increment.
+      /// @return a reference to itself.
+      ConstIterator & operator++();
+      /// Post-increment.
+      /// @return the iterator before incrementation.
+      ConstIterator operator++( int );
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on the same slot.
+      bool operator==( const ConstIterator & other ) const;
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on different slots.
+      bool operator!=( const ConstIterator & other ) const;
+      /// @return the slot of the current point.
+      Size slot() const;
+
+    private:
+      /// The visited set.
+      const DigitalSetByOpenAddressing* mySet;
+      /// The current slot.
+      Size mySlot;
+    };
+
+    ///Iterator type (same as ConstIterator).
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByOpenAddressing();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     * @param aHash the hash functor.
+     */
+    DigitalSetByOpenAddressing( Clone<Domain> d, const Hash & aHash = Hash() );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByOpenAddressing ( const DigitalSetByOpenAddressing & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByOpenAddressing & operator= ( const DigitalSetByOpenAddressing & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. For forward ranges, the table is first grown to hold
+     * all the points, and consecutive duplicates (as found in sorted
+     * ranges) are inserted only once.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set. The capacity is kept.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * Grows the table so that \a n points can be stored without
+     * rehashing.
+     *
+     * @param n the expected number of points.
+     */
+    void reserve( Size n );
+
+    /**
+     * @return the number of slots of the table.
+     */
+    Size capacity() const;
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByOpenAddressing & operator+=( const DigitalSetByOpenAddressing & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByOpenAddressing & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The hash functor.
+    Hash myHash;
+
+    /// The slots storing the points (size is a power of two or zero).
+    std::vector<Point> mySlots;
+
+    /// The state of each slot (EMPTY, FULL or ERASED).
+    std::vector<SlotState> myStates;
+
+    /// The number of points in the set.
+    Size mySize;
+
+    /// The number of slots marked ERASED.
+    Size myNbErased;
+
+    /// The number of bits of the slot indices (capacity is 2^myNbBits).
+    unsigned int myNbBits;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByOpenAddressing();
+
+    /**
+     * @param p any point.
+     * @return the home slot of \a p.
+     */
+    Size homeSlot( const Point & p ) const;
+
+    /**
+     * @param p any point.
+     * @return the slot containing \a p, or capacity() if \a p is not
+     * in the set.
+     */
+    Size lookup( const Point & p ) const;
+
+    /**
+     * Rebuilds the table with 2^nbBits slots, discarding erased marks.
+     * @param nbBits the new number of bits of slot indices.
+     */
+    void rehash( unsigned int nbBits );
+
+    /**
+     * Grows or cleans the table if one more point would exceed the
+     * maximal load factor.
+     */
+    void prepareInsertion();
+
+    /**
+     * Stores \a p in the first non full slot of its probe sequence.
+     * @param p any point not in the set.
+     * @pre the table has at least one non full slot.
+     */
+    void place( const Point & p );
+
+  }; // end of class DigitalSetByOpenAddressing
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByOpenAddressing'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByOpenAddressing' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain, typename Hash>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByOpenAddressing<Domain, Hash> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByOpenAddressing_h
+
+#undef DigitalSetByOpenAddressing_RECURSES
+#endif // else defined(DigitalSetByOpenAddressing_RECURSES)
@@ -0,0 +1,589 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByRuns.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+    Description of template class 'DigitalSetByRuns' <p>
+
+    \brief Aim: A run-length encoded container for storing sets of
+    digital points within some given HyperRectDomain, e.g. binary
+    segmentation masks.
+
+    The domain is cut into rows along the first dimension, and each
+    row stores the sorted list of its maximal runs (intervals of
+    consecutive points of the set). Runs are stored in a single array
+    in the domain scanning order, together with the index of the first
+    run of each row. Hence:
+    - the memory footprint is proportional to the number of runs plus
+      the number of rows, instead of the number of points;
+    - membership tests are O(log r), r being the number of runs of the
+      row of the point;
+    - union (operator+=, operator|=), intersection (operator&=),
+      difference (operator-=) and complement are computed run per run,
+      in time linear in the number of runs and rows;
+    - the set is built in one scan of a domain box from any point
+      predicate (e.g. a thresholded image, see
+      SimpleThresholdForegroundPredicate), see assignFromPredicate;
+    - points are visited in the domain scanning order, and runs can be
+      visited directly as spans (see spanBegin()).
+
+    The set is read-only point-wise: points are not inserted or erased
+    one at a time, the set is rather built from predicates and
+    combined with other sets. Shapes::digitalShaper and
+    Shapes::euclideanShaper accept it.
+
+    Model of concepts::CPointPredicate, of the read-only services of
+    concepts::CDigitalSet (domain, size, find, iteration, bounding box,
+    complement) and of concepts::CConstImage with boolean values. It
+    can be given directly as point predicate to DistanceTransformation
+    or VoronoiMap.
+
+    @tparam TDomain type of domain on which the set will be defined, a
+    HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+
+    ///Domain type.
+    typedef TDomain Domain;
+    ///Self Type.
+    typedef DigitalSetByRuns<Domain> Self;
+    ///Type of digital space.
+    typedef typename Domain::Space Space;
+    ///Type of points in the space.
+    typedef typename Domain::Point Point;
+    ///Type of point coordinates.
+    typedef typename Domain::Integer Integer;
+    ///Size type.
+    typedef typename Domain::Size Size;
+    ///Dimension type.
+    typedef typename Domain::Dimension Dimension;
+    ///Value type (as a set).
+    typedef Point value_type;
+    ///Value type (as an image).
+    typedef bool Value;
+    ///Range of values (as an image).
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+
+    /// A run: the first coordinates of its first and last points in a row.
+    struct Run
+    {
+      Integer begin;
+      Integer end;
+    };
+
+    /// A span: the first and last points of a run.
+    struct Span
+    {
+      Point first;
+      Point last;
+
+      /// @return the number of points of the span.
+      Size size() const
+      {
+        return static_cast<Size>( last[ 0 ] - first[ 0 ] + 1 );
+      }
+    };
+
+    /**
+       Forward iterator visiting the points of the set in the
+       scanning order of the domain. Iterator and ConstIterator are
+       the same type.
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /// Default constructor (singular iterator).
+      ConstIterator();
+
+      /**
+         Constructor from a set, a run and a point of this run.
+
+         @param aSet the set to visit.
+         @param aRun any run index (at most the number of runs).
+         @param aPoint a point of the run (ignored if \a aRun is the
+         number of runs).
+      */
+      ConstIterator( const DigitalSetByRuns & aSet, Size aRun, const Point & aPoint );
+
+      /// @return the current point.
+      reference operator*() const;
+      /// @return a pointer on the current point.
+      pointer operator->() const;
+      /// Pre-increment.
+      /// @return a reference to itself.
+      ConstIterator & operator++();
+      /// Post-increment.
+      /// @return the iterator before incrementation.
+      ConstIterator operator++( int );
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on the same point.
+      bool operator==( const ConstIterator & other ) const;
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on different points.
+      bool operator!=( const ConstIterator & other ) const;
+
+    private:
+      /// The visited set.
+      const DigitalSetByRuns* mySet;
+      /// The current run index.
+      Size myRun;
+      /// The row of the current run.
+      Size myRow;
+      /// The current point.
+      Point myPoint;
+    };
+
+    ///Iterator type (same as ConstIterator).
+    typedef ConstIterator Iterator;
+
+    /**
+       Forward iterator visiting the runs of the set, as spans, in the
+       scanning order of the domain.
+    */
+    class SpanConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Span value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Span* pointer;
+      typedef const Span& reference;
+
+      /// Default constructor (singular iterator).
+      SpanConstIterator();
+
+      /**
+         Constructor from a set and a run.
+
+         @param aSet the set to visit.
+         @param aRun any run index (at most the number of runs).
+      */
+      SpanConstIterator( const DigitalSetByRuns & aSet, Size aRun );
+
+      /// @return the current span.
+      reference operator*() const;
+      /// @return a pointer on the current span.
+      pointer operator->() const;
+      /// Pre-increment.
+      /// @return a reference to itself.
+      SpanConstIterator & operator++();
+      /// Post-increment.
+      /// @return the iterator before incrementation.
+      SpanConstIterator operator++( int );
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on the same run.
+      bool operator==( const SpanConstIterator & other ) const;
+      /// @param other any iterator.
+      /// @return 'true' iff both iterators point on different runs.
+      bool operator!=( const SpanConstIterator & other ) const;
+
+    private:
+      /// Updates the current span from the current run.
+      void update();
+
+      /// The visited set.
+      const DigitalSetByRuns* mySet;
+      /// The current run index.
+      Size myRun;
+      /// The row of the current run.
+      Size myRow;
+      /// The current span.
+      Span mySpan;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( Clone<Domain> d );
+
+    /**
+     * Constructor.
+     * Creates the set of the points of the domain [d] that satisfy
+     * the predicate [aPredicate], in one scan.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param d any domain.
+     * @param aPredicate any point predicate.
+     */
+    template <typename TPointPredicate>
+    DigitalSetByRuns( Clone<Domain> d, const TPointPredicate & aPredicate );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Set union to left, run per run.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator+=( const DigitalSetByRuns & aSet );
+
+    /**
+     * Set union to left (same as operator+=).
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator|=( const DigitalSetByRuns & aSet );
+
+    /**
+     * Set intersection to left, run per run.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator&=( const DigitalSetByRuns & aSet );
+
+    /**
+     * Set difference to left, run per run.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator-=( const DigitalSetByRuns & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Model of concepts::CConstImage -----------------------------
+  public:
+
+    /**
+     * @return the range of the values of the image (true for the
+     * points of the set), in the scanning order of the domain.
+     */
+    ConstRange constRange() const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Builds in this set the points of the domain that satisfy the
+     * predicate [aPredicate], in one scan of the domain.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aPredicate any point predicate.
+     */
+    template <typename TPointPredicate>
+    void assignFromPredicate( const TPointPredicate & aPredicate );
+
+    /**
+     * Builds in this set the points of the box [lower,upper] (clipped
+     * to the domain) that satisfy the predicate [aPredicate], in one
+     * scan of the box.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param aPredicate any point predicate.
+     * @param lower the lower bound of the box.
+     * @param upper the upper bound of the box.
+     */
+    template <typename TPointPredicate>
+    void assignFromPredicate( const TPointPredicate & aPredicate,
+                              const Point & lower, const Point & upper );
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this, run per run.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByRuns & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @return the number of runs (or spans) of this set.
+     */
+    Size nbSpans() const;
+
+    /**
+     * @return a const iterator on the first span of this set.
+     */
+    SpanConstIterator spanBegin() const;
+
+    /**
+     * @return a const iterator after the last span of this set.
+     */
+    SpanConstIterator spanEnd() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The runs, row after row, sorted and disjoint in each row.
+    std::vector<Run> myRuns;
+
+    /// The index of the first run of each row, followed by the number of runs.
+    std::vector<Size> myRowStarts;
+
+    /// The number of points in the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the row of \a p.
+     */
+    Size row( const Point & p ) const;
+
+    /**
+     * @param aRow any row index.
+     * @param x any first coordinate.
+     * @return the point of the row \a aRow with first coordinate \a x.
+     */
+    Point rowPoint( Size aRow, Integer x ) const;
+
+    /**
+     * @param aRun any run index.
+     * @param aRow any row index not greater than the row of \a aRun.
+     * @return the row of the run \a aRun, searched from row \a aRow.
+     */
+    Size nextRow( Size aRun, Size aRow ) const;
+
+    /**
+     * Replaces this set by the result of a boolean operation on this
+     * set and [aSet], run per run.
+     *
+     * @tparam TOperation a boolean function of two booleans.
+     * @param aSet any other set, on the same domain.
+     * @param anOperation tells if a point is in the result from its
+     * membership to this set and to \a aSet.
+     */
+    template <typename TOperation>
+    void combine( const DigitalSetByRuns & aSet, const TOperation & anOperation );
+
+    /**
+     * Applies a boolean operation to the runs of two rows and appends
+     * the result.
+     *
+     * @tparam TOperation a boolean function of two booleans.
+     * @param a the first run of the first row.
+     * @param aEnd after the last run of the first row.
+     * @param b the first run of the second row.
+     * @param bEnd after the last run of the second row.
+     * @param anOperation the boolean operation.
+     * @param[out] runs the runs to complete.
+     * @return the number of points of the appended runs.
+     */
+    template <typename TOperation>
+    static Size combineRows( const Run * a, const Run * aEnd,
+                             const Run * b, const Run * bEnd,
+                             const TOperation & anOperation,
+                             std::vector<Run> & runs );
+
+    /**
+     * @param aSet any set.
+     * @return \a aSet, converted to the domain of this set if needed.
+     */
+    DigitalSetByRuns onSameDomain( const DigitalSetByRuns & aSet ) const;
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
@@ -48,9 +48,11 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
+#include <type_traits>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -61,6 +63,34 @@ namespace DGtal
   enum DigitalSetVariability { LOW_VAR_DS = 0, HIGH_VAR_DS = 4 };
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
+  enum DigitalSetStorage { DEFAULT_STORAGE_DS = 0, BITSET_DS = 32 };
+
+  namespace details
+  {
+    /**
+     * Default choice of DigitalSetSelector: a hash set of points.
+     */
+    template <typename Domain, int Preferences >
+    struct DigitalSetSelectorHelper
+    {
+      typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    };
+
+    /**
+     * Choice of DigitalSetSelector for HyperRectDomain: sets requested
+     * with BITSET_DS are stored as one bit per domain point.
+     */
+    template <typename Space, int Preferences >
+    struct DigitalSetSelectorHelper< HyperRectDomain<Space>, Preferences >
+    {
+      typedef HyperRectDomain<Space> Domain;
+      typedef typename std::conditional
+      < ( ( Preferences & BITSET_DS ) != 0 ),
+        DigitalSetByBitset<Domain>,
+        DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> >
+        >::type Type;
+    };
+  } // namespace details
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
@@ -69,6 +99,12 @@ namespace DGtal
    * Aim: Automatically defines an adequate digital set type according
    * to the hints given by the user.
    *
+   * Sets are represented with a hash set of points
+   * (DigitalSetByAssociativeContainer). Adding BITSET_DS to the
+   * preferences selects DigitalSetByBitset when the domain is a
+   * HyperRectDomain, which pays one bit per domain point whatever the
+   * size of the set.
+   *
    * @code
    typedef SpaceND<int,4> Space4;
    typedef HyperRectDomain<Space4> Domain;
@@ -91,7 +127,7 @@ namespace DGtal
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef typename details::DigitalSetSelectorHelper< Domain, Preferences >::Type Type;
   }; // end of class DigitalSetSelector
 
 
@@ -45,6 +45,7 @@
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/helpers/Surfaces.h"
@@ -105,6 +106,21 @@ namespace DGtal
     static void digitalShaper( TDigitalSet & aSet,
                                const TShapeFunctor & aFunctor);
 
+    /**
+     * Adds to the (perhaps non empty) run-length encoded set [aSet]
+     * the shape defined by an instance of ShapeFunctor. The runs of
+     * the shape are built in one scan of its bounding box (clipped to
+     * the domain of the set), then merged with the runs of the set.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TShapeFunctor>
+    static void digitalShaper( DigitalSetByRuns<Domain> & aSet,
+                               const TShapeFunctor & aFunctor);
+
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
      * an instance of ShapeFunctor. Add Points where orientation is inside.
@@ -45,6 +45,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CConstSinglePassRange.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CUnsignedNumber.h"
 #include "DGtal/kernel/CIntegralNumber.h"
@@ -105,12 +106,12 @@ details.
 - \e Vector: the type for defining vectors in \e Space  (same as Space::Vector).
 - \e Cells: a container that stores unsigned cells (not a set, rather a enumerable collection type, model of CConstSinglePassRange).
 - \e SCells: a container that stores signed cells (not a set, rather a enumerable collection type, model of CConstSinglePassRange).
-- \e CellSet: a set container that stores unsigned cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e SCellSet: a set container that stores signed cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e SurfelSet: a set container that stores surfels, i.e. signed n-1-cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e CellMap<Value>: an associative container Cell->Value rebinder type (efficient for key queries). Use as \c typename X::template CellMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
-- \e SCellMap<Value>: an associative container SCell->Value rebinder type (efficient for key queries). Use as \c typename X::template SCellMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
-- \e SurfelMap<Value>: an associative container Surfel->Value rebinder type (efficient for key queries). Use as \c typename X::template SurfelMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
+- \e CellSet: a set container that stores unsigned cells (efficient for queries like \c find, model of concepts::CSTLAssociativeContainer, e.g. std::set or std::unordered_set).
+- \e SCellSet: a set container that stores signed cells (efficient for queries like \c find, model of concepts::CSTLAssociativeContainer, e.g. std::set or std::unordered_set).
+- \e SurfelSet: a set container that stores surfels, i.e. signed n-1-cells (efficient for queries like \c find, model of concepts::CSTLAssociativeContainer, e.g. std::set or std::unordered_set).
+- \e CellMap<Value>: an associative container Cell->Value rebinder type (efficient for key queries). Use as \c typename X::template CellMap<Value>::Type, which is a model of concepts::CSTLAssociativeContainer mapping keys to values (e.g. std::map or std::unordered_map).
+- \e SCellMap<Value>: an associative container SCell->Value rebinder type (efficient for key queries). Use as \c typename X::template SCellMap<Value>::Type, which is a model of concepts::CSTLAssociativeContainer mapping keys to values (e.g. std::map or std::unordered_map).
+- \e SurfelMap<Value>: an associative container Surfel->Value rebinder type (efficient for key queries). Use as \c typename X::template SurfelMap<Value>::Type, which is a model of concepts::CSTLAssociativeContainer mapping keys to values (e.g. std::map or std::unordered_map).
 
 
 \note DirIterator should be use as follows:
@@ -311,18 +312,20 @@ public:
   BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Vector, typename Space::Vector >::value ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< Cells > ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< SCells > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SurfelMap > ));
+  // Sets and maps may be ordered or hashed containers, hence
+  // CSTLAssociativeContainer instead of boost::AssociativeContainer.
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< CellSet > ));
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< SCellSet > ));
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< SurfelSet > ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Cell, typename CellSet::value_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< SCell, typename SCellSet::value_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< SCell, typename SurfelSet::value_type >::value ));
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< CellMap > ));
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< SCellMap > ));
+  BOOST_CONCEPT_ASSERT(( CSTLAssociativeContainer< SurfelMap > ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename CellMap::mapped_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename SCellMap::mapped_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename SurfelMap::mapped_type >::value ));
 
   BOOST_CONCEPT_USAGE( CPreCellularGridSpaceND )
   {
@@ -0,0 +1,330 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ConnectedComponentLabelling.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Tells if an adjacency is invariant by translation, i.e. if
+   * p and q are adjacent iff p+v and q+v are adjacent, so that it is
+   * entirely described by its neighborhood of the origin. This is the
+   * case of all metric adjacencies (4/8 in 2D, 6/18/26 in 3D).
+   *
+   * @tparam TAdjacency any adjacency type.
+   */
+  template <typename TAdjacency>
+  struct IsTranslationInvariantAdjacency : public std::false_type {};
+
+  template <typename TSpace, Dimension maxNorm1, Dimension dimension>
+  struct IsTranslationInvariantAdjacency
+  < MetricAdjacency< TSpace, maxNorm1, dimension > >
+    : public std::true_type {};
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Labels the connected components of a binary image (or of
+   * any point predicate) defined over a HyperRectDomain, for a
+   * translation invariant adjacency such as the 4/8 or 6/18/26
+   * adjacencies.
+   *
+   * The algorithm is a two-pass union-find over the linearized domain
+   * (the first coordinate varying fastest, as in
+   * ImageContainerBySTLVector). Each point is only united with its
+   * already visited neighbors. The domain is cut into slabs along the
+   * last axis, which are labelled independently (in parallel when
+   * DGtal is compiled with OpenMP); the union-find trees of
+   * consecutive slabs are then merged along their common boundary, and
+   * a last parallel pass writes the final labels.
+   *
+   * Labels are consecutive: 0 is the background and components are
+   * numbered from 1 to nbComponents(), in the order of their first
+   * point in the domain scan.
+   *
+   * @code
+   * ConnectedComponentLabelling< Z3i::Space > ccl( domain, Z3i::Adj26() );
+   * ccl.compute( image );   // any image or predicate convertible to bool
+   * trace.info() << ccl.nbComponents() << " components, first has "
+   *              << ccl.size( 1 ) << " voxels." << std::endl;
+   * @endcode
+   *
+   * @tparam TSpace the digital space.
+   * @tparam TLabel the integer type of labels. It must be able to
+   * represent the number of points of the labelled domain.
+   */
+  template <typename TSpace, typename TLabel = DGtal::uint32_t>
+  class ConnectedComponentLabelling
+  {
+    BOOST_STATIC_ASSERT(( std::numeric_limits<TLabel>::is_integer ));
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef TSpace Space;
+    typedef TLabel Label;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Size Size;
+    typedef HyperRectDomain< Space > Domain;
+    typedef ImageContainerBySTLVector< Domain, Label > LabelImage;
+
+    /// The label of background points.
+    static const Label background = 0;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @tparam TAdjacency a translation invariant adjacency over Space.
+     * @param aDomain the domain to label.
+     * @param adjacency the adjacency defining the connectedness.
+     */
+    template <typename TAdjacency>
+    ConnectedComponentLabelling( const Domain & aDomain,
+                                 const TAdjacency & adjacency );
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabelling() = default;
+
+    /**
+     * Labels the connected components of the points of the domain
+     * satisfying the given predicate.
+     *
+     * @tparam TPointPredicate a type of functor Point -> bool (or
+     * convertible to bool), e.g. a binary image or a thresholded image.
+     *
+     * @param isForeground the predicate telling foreground points. It
+     * may be called concurrently from several threads.
+     *
+     * @return the number of connected components.
+     */
+    template <typename TPointPredicate>
+    Size compute( const TPointPredicate & isForeground );
+
+    /**
+     * @return the labelled domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the label image of the last computation.
+     */
+    const LabelImage & labels() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the label of p (0 for background points).
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @return the number of connected components of the last computation.
+     */
+    Size nbComponents() const;
+
+    /**
+     * @return the sizes of the components, indexed by label. The first
+     * element is the number of background points.
+     */
+    const std::vector< Size > & sizes() const;
+
+    /**
+     * @param l any label.
+     * @return the number of points having label l.
+     */
+    Size size( Label l ) const;
+
+    /**
+     * @return the neighbors of the origin that precede it in the
+     * domain scan (half of the neighborhood).
+     */
+    const std::vector< Vector > & backwardNeighborhood() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The labelled domain.
+    Domain myDomain;
+    /// The extent of the domain along each axis.
+    Vector myExtent;
+    /// The already visited neighbors of the origin.
+    std::vector< Vector > myOffsets;
+    /// The linear shifts corresponding to myOffsets.
+    std::vector< std::ptrdiff_t > myShifts;
+    /// The union-find forest (only used during compute).
+    std::vector< Label > myParent;
+    /// The label image.
+    LabelImage myLabels;
+    /// The sizes of components, indexed by label.
+    std::vector< Size > mySizes;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /// Marks background points in the union-find forest.
+    static const Label NOT_FOREGROUND = std::numeric_limits< Label >::max();
+
+    /**
+     * @param i the linear index of a foreground point.
+     * @return the root of its tree, compressing the path to it.
+     */
+    Label find( Label i );
+
+    /**
+     * Merges the trees of two foreground points. The root with the
+     * smallest index becomes the root of the union.
+     * @param i the linear index of a foreground point.
+     * @param j the linear index of another foreground point.
+     */
+    void unite( Label i, Label j );
+
+    /**
+     * First pass on the slab of points whose last coordinate is in
+     * [first,last]: unites each foreground point with its visited
+     * neighbors of the same slab, then makes every point point
+     * directly to the root of its tree.
+     *
+     * @param isForeground the foreground predicate.
+     * @param first the first layer of the slab.
+     * @param last the last layer of the slab.
+     * @param[out] roots the roots of the slab, in increasing order.
+     */
+    template <typename TPointPredicate>
+    void labelSlab( const TPointPredicate & isForeground,
+                    typename Space::Integer first,
+                    typename Space::Integer last,
+                    std::vector< Label > & roots );
+
+    /**
+     * Unites the points of the layer [layer] with their neighbors in
+     * the previous layer.
+     * @param layer the first layer of a slab.
+     */
+    void mergeLayer( typename Space::Integer layer );
+
+    /**
+     * @param p any point of the domain.
+     * @return its linear index.
+     */
+    Label linearize( const Point & p ) const;
+
+    /**
+     * @param p a point of the domain.
+     * @param v a vector of the neighborhood.
+     * @param firstLayer the lowest last coordinate allowed for p+v.
+     * @return 'true' iff p+v lies in the domain and its last
+     * coordinate is not below firstLayer.
+     */
+    bool isNeighborInside( const Point & p, const Vector & v,
+                           typename Space::Integer firstLayer ) const;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling ( const ConnectedComponentLabelling & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling & operator= ( const ConnectedComponentLabelling & other );
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TLabel>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConnectedComponentLabelling<TSpace, TLabel> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
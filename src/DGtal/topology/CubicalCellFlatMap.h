@@ -0,0 +1,598 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CubicalCellFlatMap.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module CubicalCellFlatMap.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CubicalCellFlatMap_RECURSES)
+#error Recursive header files inclusion detected in CubicalCellFlatMap.h
+#else // defined(CubicalCellFlatMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CubicalCellFlatMap_RECURSES
+
+#if !defined CubicalCellFlatMap_h
+/** Prevents repeated inclusion of headers. */
+#define CubicalCellFlatMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/dynamic_bitset.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/SetFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CubicalCellFlatMap
+  /**
+   * Description of template class 'CubicalCellFlatMap' <p>
+   * \brief Aim: An associative container Cell -> Data for the cells of
+   * one dimension of a bounded Khalimsky space, meant as the cell
+   * container of a CubicalComplex on dense complexes.
+   *
+   * Every cell of the given dimension has a slot in a flat array,
+   * indexed by its linearized Khalimsky coordinates, and a bit in a
+   * membership bitset. Finding, inserting or erasing a cell is thus a
+   * few integer operations instead of a tree traversal, which speeds up
+   * CubicalComplex::close, open, star, link and collapse. The union,
+   * intersection, difference and symmetric difference of two maps
+   * (functions::setops) as well as the equality and inclusion tests
+   * (functions::isEqual, functions::isSubset) are word-wide bitset
+   * operations. They require both maps to be bound to the same space.
+   *
+   * Cells of a dimension are grouped by orientation (the parities of
+   * their Khalimsky coordinates), each orientation being a grid
+   * linearized with the first coordinate varying fastest. Iterators
+   * visit the cells in this order. The cells are stored next to their
+   * data, so that iterators give std::pair<const Cell, Data> values as
+   * std::map does.
+   *
+   * A default constructed map is empty and cannot hold any cell. It
+   * must first be bound to a space and a dimension with init(). A
+   * CubicalComplex binds its containers when it is given its space.
+   * Looking up a cell that the map cannot hold (another dimension,
+   * outside the space, or an unbound map) finds nothing, while
+   * inserting it throws std::out_of_range.
+   *
+   * @code
+   * typedef CubicalCellFlatMap< KSpace, CubicalCellData > FlatMap;
+   * typedef CubicalComplex< KSpace, FlatMap >             CC;
+   * CC complex( K );
+   * @endcode
+   *
+   * @note The memory is proportional to the number of cells of the
+   * space, not to the number of cells of the map: this container is
+   * only interesting for complexes that fill a notable part of their
+   * space.
+   *
+   * @tparam TKSpace a bounded Khalimsky space, e.g. KhalimskySpaceND.
+   * @tparam TData the type of data associated to cells.
+   */
+  template < typename TKSpace, typename TData >
+  class CubicalCellFlatMap
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef CubicalCellFlatMap< TKSpace, TData > Self;
+    typedef TKSpace                              KSpace;
+    typedef typename KSpace::Cell                Cell;
+    typedef typename KSpace::Point               Point;
+    typedef typename KSpace::Integer             Integer;
+
+    typedef Cell                                 key_type;
+    typedef TData                                mapped_type;
+    typedef std::pair< const Cell, TData >       value_type;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type*                          pointer;
+    typedef const value_type*                    const_pointer;
+    typedef std::size_t                          size_type;
+    typedef std::ptrdiff_t                       difference_type;
+
+    /// The membership bitset.
+    typedef boost::dynamic_bitset< DGtal::uint64_t > Bitset;
+
+    /// The number of cell orientations.
+    static const unsigned int nbOrientations = 1u << KSpace::dimension;
+
+    /**
+     * Forward iterator on the cells of the map, skipping the slots of
+     * the cells that do not belong to it.
+     * @tparam TValue the value type (const or not).
+     * @tparam TMap the map type (const or not).
+     */
+    template < typename TValue, typename TMap >
+    class Iterator
+      : public boost::iterator_facade< Iterator< TValue, TMap >, TValue,
+                                       std::forward_iterator_tag >
+    {
+    public:
+      friend class CubicalCellFlatMap;
+      friend class boost::iterator_core_access;
+      template < typename V, typename M > friend class Iterator;
+
+      /// Default constructor. The iterator is not valid.
+      Iterator() : myMap( 0 ), myIndex( 0 ) {}
+
+      /**
+       * Constructor from a map and an index.
+       * @param map the visited map.
+       * @param index the index of a cell of the map, or the number of slots.
+       */
+      Iterator( TMap & map, size_type index ) : myMap( &map ), myIndex( index ) {}
+
+      /**
+       * Conversion from an iterator (mutable to const).
+       * @param other another iterator.
+       */
+      template < typename V, typename M >
+      Iterator( const Iterator< V, M > & other,
+                typename std::enable_if< std::is_convertible< M*, TMap* >::value >::type* = 0 )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+    private:
+      /// The visited map.
+      TMap* myMap;
+      /// The index of the current cell.
+      size_type myIndex;
+
+      void increment()
+      {
+        myIndex = myMap->nextIndex( myIndex );
+      }
+
+      template < typename V, typename M >
+      bool equal( const Iterator< V, M > & other ) const
+      {
+        return myIndex == other.myIndex && myMap == other.myMap;
+      }
+
+      TValue & dereference() const
+      {
+        return myMap->myValues[ myIndex ];
+      }
+    };
+
+    typedef Iterator< value_type, Self >             iterator;
+    typedef Iterator< const value_type, const Self > const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The map is not bound to any space and
+     * cannot hold cells.
+     */
+    CubicalCellFlatMap();
+
+    /**
+     * Constructor. The map is empty.
+     * @param aK a bounded Khalimsky space.
+     * @param d the dimension of the cells of the map.
+     */
+    CubicalCellFlatMap( const KSpace & aK, Dimension d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    CubicalCellFlatMap( const CubicalCellFlatMap & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    CubicalCellFlatMap & operator=( const CubicalCellFlatMap & other );
+
+    /**
+     * Destructor.
+     */
+    ~CubicalCellFlatMap() = default;
+
+    /**
+     * Binds the map to a space and a dimension. The map is empty
+     * afterwards.
+     * @param aK a bounded Khalimsky space.
+     * @param d the dimension of the cells of the map.
+     */
+    void init( const KSpace & aK, Dimension d );
+
+    /**
+     * @return the dimension of the cells of the map.
+     */
+    Dimension dimension() const;
+
+    /**
+     * @return the number of cells that may belong to the map.
+     */
+    size_type capacity() const;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of cells of the map.
+    size_type size() const;
+    /// @return the maximal number of cells of the map.
+    size_type max_size() const;
+    /// @return 'true' iff the map has no cell.
+    bool empty() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /**
+     * @param aCell any cell of the space of the right dimension.
+     * @return an iterator on this cell if it belongs to the map, end() otherwise.
+     */
+    iterator       find( const Cell & aCell );
+    /// @copydoc find
+    const_iterator find( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell of the space of the right dimension.
+     * @return 1 if the cell belongs to the map, 0 otherwise.
+     */
+    size_type count( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell of the space of the right dimension.
+     * @return the range of the cells of the map equal to aCell.
+     */
+    std::pair< iterator, iterator > equal_range( const Cell & aCell );
+    /// @copydoc equal_range
+    std::pair< const_iterator, const_iterator > equal_range( const Cell & aCell ) const;
+
+    /**
+     * Inserts a cell with its data, if the cell does not belong to the map.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell and 'true' if it was inserted.
+     * @throw std::out_of_range if the map cannot hold the cell.
+     */
+    std::pair< iterator, bool > insert( const value_type & value );
+
+    /**
+     * Inserts a cell with its data. The hint is useless.
+     * @param hint any iterator.
+     * @param value a pair (cell, data).
+     * @return an iterator on the cell.
+     * @throw std::out_of_range if the map cannot hold the cell.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * @param aCell any cell of the space of the right dimension.
+     * @return a reference on its data, after inserting it with a
+     * default data if it did not belong to the map.
+     * @throw std::out_of_range if the map cannot hold the cell.
+     */
+    mapped_type & operator[]( const Cell & aCell );
+
+    /**
+     * Removes a cell.
+     * @param aCell any cell of the space of the right dimension.
+     * @return the number of removed cells (0 or 1).
+     */
+    size_type erase( const Cell & aCell );
+
+    /**
+     * Removes the cell pointed by an iterator. Other iterators stay valid.
+     * @param position a valid iterator.
+     * @return an iterator on the following cell.
+     */
+    iterator erase( const_iterator position );
+
+    /**
+     * Removes the cells of a range.
+     * @param first the first cell to remove.
+     * @param last the cell after the last one to remove.
+     * @return last.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /// Removes all the cells. The map stays bound to its space.
+    void clear();
+
+    /**
+     * Swaps the content of two maps.
+     * @param other another map.
+     */
+    void swap( CubicalCellFlatMap & other );
+
+    /**
+     * @return the membership bitset, indexed as the cells.
+     */
+    const Bitset & membership() const;
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /**
+     * Adds the cells of another map, with their data.
+     * @param other a map bound to the same space and dimension.
+     * @return a reference on 'this'.
+     */
+    Self & assignUnion( const Self & other );
+
+    /**
+     * Removes the cells not belonging to another map.
+     * @param other a map bound to the same space and dimension.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & other );
+
+    /**
+     * Removes the cells of another map.
+     * @param other a map bound to the same space and dimension.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & other );
+
+    /**
+     * Keeps the cells belonging to exactly one of the two maps, with
+     * their data.
+     * @param other a map bound to the same space and dimension.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & other );
+
+    /**
+     * @param other a map bound to the same space and dimension.
+     * @return 'true' iff both maps have the same cells.
+     */
+    bool isEqual( const Self & other ) const;
+
+    /**
+     * @param other a map bound to the same space and dimension.
+     * @return 'true' iff every cell of this map belongs to \a other.
+     */
+    bool isSubset( const Self & other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The dimension of the cells.
+    Dimension myDimension;
+    /// The first even and odd Khalimsky coordinates along each axis.
+    Integer myFirst[ KSpace::dimension ][ 2 ];
+    /// The first index of each orientation.
+    size_type myOffsets[ nbOrientations ];
+    /// The strides of each orientation.
+    size_type myStrides[ nbOrientations ][ KSpace::dimension ];
+    /// The orientations of the cells of the map, in index order.
+    std::vector< unsigned int > myOrientations;
+    /// Every cell of the dimension with its data.
+    std::vector< value_type > myValues;
+    /// Membership of each cell.
+    Bitset myBits;
+    /// The number of cells of the map.
+    size_type mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * @param aCell any cell.
+     * @return its index, or the number of slots if the map cannot hold it.
+     */
+    size_type index( const Cell & aCell ) const;
+
+    /**
+     * @param aCell any cell.
+     * @return its index.
+     * @throw std::out_of_range if the map cannot hold the cell.
+     */
+    size_type checkedIndex( const Cell & aCell ) const;
+
+    /// Sets the indexing tables of an unbound map.
+    void resetIndexing();
+
+    /**
+     * @param i an index or the number of slots.
+     * @return the index of the next cell of the map, or the number of slots.
+     */
+    size_type nextIndex( size_type i ) const;
+
+    /**
+     * Copies the data of the cells flagged in \a bits from \a other.
+     * @param other a map bound to the same space and dimension.
+     * @param bits a subset of the cells of \a other.
+     */
+    void copyData( const Self & other, const Bitset & bits );
+
+  }; // end of class CubicalCellFlatMap
+
+  /// Defines container traits for CubicalCellFlatMap.
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< CubicalCellFlatMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CubicalCellFlatMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CubicalCellFlatMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const CubicalCellFlatMap< TKSpace, TData > & object );
+
+  namespace detail
+  {
+    /**
+     * Binds the cell container of dimension \a d of a cubical complex
+     * to the space of the complex. Nothing is done for ordinary
+     * associative containers.
+     * @tparam TCellContainer the cell container type of the complex.
+     */
+    template < typename TCellContainer >
+    struct CubicalCellContainerBinder
+    {
+      template < typename TKSpace >
+      static void bind( TCellContainer &, const TKSpace &, Dimension ) {}
+    };
+
+    /// Binds a CubicalCellFlatMap to its space.
+    template < typename TKSpace, typename TData >
+    struct CubicalCellContainerBinder< CubicalCellFlatMap< TKSpace, TData > >
+    {
+      static void bind( CubicalCellFlatMap< TKSpace, TData > & map,
+                        const TKSpace & aK, Dimension d )
+      {
+        map.init( aK, d );
+      }
+    };
+  } // namespace detail
+
+  namespace functions
+  {
+    /**
+     * Equality test with bitset operations.
+     * @param[in] S1 an input map.
+     * @param[in] S2 another input map, bound to the same space.
+     * @return true iff \a S1 and \a S2 have the same cells.
+     */
+    template < typename TKSpace, typename TData >
+    bool isEqual( const CubicalCellFlatMap< TKSpace, TData >& S1,
+                  const CubicalCellFlatMap< TKSpace, TData >& S2 )
+    {
+      return S1.isEqual( S2 );
+    }
+
+    /**
+     * Inclusion test with bitset operations.
+     * @param[in] S1 an input map.
+     * @param[in] S2 another input map, bound to the same space.
+     * @return true iff \a S1 is a subset of \a S2.
+     */
+    template < typename TKSpace, typename TData >
+    bool isSubset( const CubicalCellFlatMap< TKSpace, TData >& S1,
+                   const CubicalCellFlatMap< TKSpace, TData >& S2 )
+    {
+      return S1.isSubset( S2 );
+    }
+
+    namespace setops
+    {
+      /**
+       * Set difference with bitset operations. Updates S1 as S1 - S2.
+       * @param[in,out] S1 an input map, \a S1 - \a S2 as output.
+       * @param[in] S2 another input map, bound to the same space.
+       * @return a reference on S1.
+       */
+      template < typename TKSpace, typename TData >
+      inline CubicalCellFlatMap< TKSpace, TData >&
+      operator-=( CubicalCellFlatMap< TKSpace, TData >& S1,
+                  const CubicalCellFlatMap< TKSpace, TData >& S2 )
+      {
+        return S1.assignDifference( S2 );
+      }
+
+      /**
+       * Set union with bitset operations. Updates S1 as \f$ S1 \cup S2 \f$.
+       * @param[in,out] S1 an input map, \f$ S1 \cup S2 \f$ as output.
+       * @param[in] S2 another input map, bound to the same space.
+       * @return a reference on S1.
+       */
+      template < typename TKSpace, typename TData >
+      inline CubicalCellFlatMap< TKSpace, TData >&
+      operator|=( CubicalCellFlatMap< TKSpace, TData >& S1,
+                  const CubicalCellFlatMap< TKSpace, TData >& S2 )
+      {
+        return S1.assignUnion( S2 );
+      }
+
+      /**
+       * Set intersection with bitset operations. Updates S1 as \f$ S1 \cap S2 \f$.
+       * @param[in,out] S1 an input map, \f$ S1 \cap S2 \f$ as output.
+       * @param[in] S2 another input map, bound to the same space.
+       * @return a reference on S1.
+       */
+      template < typename TKSpace, typename TData >
+      inline CubicalCellFlatMap< TKSpace, TData >&
+      operator&=( CubicalCellFlatMap< TKSpace, TData >& S1,
+                  const CubicalCellFlatMap< TKSpace, TData >& S2 )
+      {
+        return S1.assignIntersection( S2 );
+      }
+
+      /**
+       * Symmetric difference with bitset operations. Updates S1 as \f$ S1 \Delta S2 \f$.
+       * @param[in,out] S1 an input map, \f$ S1 \Delta S2 \f$ as output.
+       * @param[in] S2 another input map, bound to the same space.
+       * @return a reference on S1.
+       */
+      template < typename TKSpace, typename TData >
+      inline CubicalCellFlatMap< TKSpace, TData >&
+      operator^=( CubicalCellFlatMap< TKSpace, TData >& S1,
+                  const CubicalCellFlatMap< TKSpace, TData >& S2 )
+      {
+        return S1.assignSymmetricDifference( S2 );
+      }
+    } // namespace setops
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CubicalCellFlatMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CubicalCellFlatMap_h
+
+#undef CubicalCellFlatMap_RECURSES
+#endif // else defined(CubicalCellFlatMap_RECURSES)
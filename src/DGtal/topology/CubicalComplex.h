@@ -52,6 +52,7 @@
 #include "DGtal/base/ContainerTraits.h"
 #include "DGtal/base/CSTLAssociativeContainer.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalCellFlatMap.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -169,7 +170,9 @@ namespace DGtal
   * it. It could be for instance a std::map or a
   * std::unordered_map. Note that unfortunately, unordered_map are
   * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * cannot check concepts here. On complexes filling a notable part
+  * of a bounded space, CubicalCellFlatMap stores the cells in flat
+  * arrays and computes set operations with bitsets.
   *
   */
   template < typename TKSpace,
@@ -39,6 +39,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <unordered_set>
+#include <unordered_map>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include <boost/functional/hash.hpp>
@@ -120,6 +122,36 @@ namespace boost{
 }
 
 
+namespace DGtal {
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Hashed container policy of KhalimskySpaceND: sets and maps
+   * of cells are std::unordered_set and std::unordered_map, using the
+   * hash functions above.
+   *
+   * Use it as the third template parameter of KhalimskySpaceND, e.g.
+   * \code
+   * typedef KhalimskySpaceND< 3, int, KhalimskySpaceNDHashedContainers > KSpace;
+   * KSpace::SurfelSet bdry; // std::unordered_set< KSpace::SCell >
+   * \endcode
+   * Every algorithm that uses KSpace::SurfelSet or
+   * KSpace::SurfelMap<Value>::Type then works with hashed containers.
+   * Note that iterating over these containers does not follow the
+   * lexicographic order of cells.
+   *
+   * @see KhalimskySpaceNDOrderedContainers
+   */
+  struct KhalimskySpaceNDHashedContainers
+  {
+    /// Set of cells.
+    template < typename TCell >
+    using Set = std::unordered_set< TCell >;
+
+    /// Mapping cell -> value.
+    template < typename TCell, typename TValue >
+    using Map = std::unordered_map< TCell, TValue >;
+  };
+}
 
 #endif // !defined KhalimskyCellHashFunctions_h
 
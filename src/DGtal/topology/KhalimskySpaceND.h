@@ -55,11 +55,34 @@
 
 namespace DGtal
 {
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Default container policy of KhalimskySpaceND: sets and maps
+   * of cells are ordered containers (std::set and std::map).
+   *
+   * A container policy defines the templates \c Set<Cell> and \c
+   * Map<Cell,Value>, which are used to define the types CellSet,
+   * SCellSet, SurfelSet, CellMap, SCellMap and SurfelMap of the
+   * space. See KhalimskySpaceNDHashedContainers (in
+   * KhalimskyCellHashFunctions.h) for a hashed alternative.
+   */
+  struct KhalimskySpaceNDOrderedContainers
+  {
+    /// Set of cells.
+    template < typename TCell >
+    using Set = std::set< TCell >;
+
+    /// Mapping cell -> value.
+    template < typename TCell, typename TValue >
+    using Map = std::map< TCell, TValue >;
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // Pre-declaration
   template <
       Dimension dim,
-      typename TInteger = DGtal::int32_t
+      typename TInteger = DGtal::int32_t,
+      typename TCellContainers = KhalimskySpaceNDOrderedContainers
   >
   class KhalimskySpaceND;
 
@@ -97,8 +120,8 @@ namespace DGtal
     using Self    = KhalimskyCell< dim, Integer >;
 
     // Friendship
-    friend class KhalimskySpaceND< dim, TInteger >;
-    friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    template < Dimension, typename, typename > friend class KhalimskySpaceND;
+    template < class > friend class KhalimskySpaceNDHelper;
 
   private:
     // Underlying pre-cell
@@ -221,8 +244,8 @@ namespace DGtal
     using Self    = SignedKhalimskyCell< dim, Integer >;
 
     // Friendship
-    friend class KhalimskySpaceND< dim, TInteger >;
-    friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    template < Dimension, typename, typename > friend class KhalimskySpaceND;
+    template < class > friend class KhalimskySpaceNDHelper;
 
   private:
     // Underlying signed pre-cell
@@ -376,8 +399,17 @@ namespace DGtal
    * to correct Khalimsky coordinates of a given cell.
    * In addition, when a method accepts a coordinate as parameter, it is always corrected along periodic dimensions.
    *
+   * The types of sets and maps of cells (CellSet, SCellSet,
+   * SurfelSet, CellMap, SCellMap, SurfelMap) are given by the
+   * container policy \a TCellContainers. The default policy gives
+   * ordered containers. KhalimskySpaceNDHashedContainers gives hashed
+   * containers, which are faster on large surfaces (e.g. for
+   * Surfaces::trackBoundary or ExplicitDigitalSurface), but are not
+   * ordered.
+   *
    * @tparam dim the dimension of the digital space.
    * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   * @tparam TCellContainers the container policy for sets and maps of cells (default is KhalimskySpaceNDOrderedContainers).
    * @note Essentially a backport from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene).
    *
    * @warning Periodic Khalimsky space and per-dimension closure specification are new features.
@@ -386,14 +418,15 @@ namespace DGtal
   */
   template <
       Dimension dim,
-      typename TInteger
+      typename TInteger,
+      typename TCellContainers
   >
   class KhalimskySpaceND
-    : private KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger > >
+    : private KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger, TCellContainers > >
   {
 
-    typedef KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger > > Helper; ///< Features basic operations on coordinates, especially for periodic dimensions.
-    friend class KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger > >;
+    typedef KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger, TCellContainers > > Helper; ///< Features basic operations on coordinates, especially for periodic dimensions.
+    friend class KhalimskySpaceNDHelper< KhalimskySpaceND< dim, TInteger, TCellContainers > >;
 
     //Integer must be signed to characterize a ring.
     BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
@@ -407,7 +440,8 @@ namespace DGtal
 
     // Spaces
     typedef SpaceND<dim, Integer> Space;
-    typedef KhalimskySpaceND<dim, Integer>    CellularGridSpace;
+    typedef KhalimskySpaceND<dim, Integer, TCellContainers> CellularGridSpace;
+    typedef TCellContainers CellContainers;
     typedef KhalimskyPreSpaceND<dim, Integer> PreCellularGridSpace;
 
     // Cells
@@ -440,30 +474,30 @@ namespace DGtal
 
     // Sets, Maps
     /// Preferred type for defining a set of Cell(s).
-    typedef std::set<Cell> CellSet;
+    typedef typename CellContainers::template Set<Cell> CellSet;
 
     /// Preferred type for defining a set of SCell(s).
-    typedef std::set<SCell> SCellSet;
+    typedef typename CellContainers::template Set<SCell> SCellSet;
 
     /// Preferred type for defining a set of surfels (always signed cells).
-    typedef std::set<SCell> SurfelSet;
+    typedef typename CellContainers::template Set<SCell> SurfelSet;
 
     /// Template rebinding for defining the type that is a mapping
     /// Cell -> Value.
     template <typename Value> struct CellMap {
-        typedef std::map<Cell,Value> Type;
+        typedef typename CellContainers::template Map<Cell,Value> Type;
     };
 
     /// Template rebinding for defining the type that is a mapping
     /// SCell -> Value.
     template <typename Value> struct SCellMap {
-        typedef std::map<SCell,Value> Type;
+        typedef typename CellContainers::template Map<SCell,Value> Type;
     };
 
     /// Template rebinding for defining the type that is a mapping
     /// SCell -> Value.
     template <typename Value> struct SurfelMap {
-        typedef std::map<SCell,Value> Type;
+        typedef typename CellContainers::template Map<SCell,Value> Type;
     };
 
     /// Boundaries closure type
@@ -1968,10 +2002,11 @@ ose sign is positive).
    * @return the output stream after the writing.
    */
   template < Dimension dim,
-             typename TInteger >
+             typename TInteger,
+             typename TCellContainers >
   std::ostream&
   operator<< ( std::ostream & out,
-               const KhalimskySpaceND<dim, TInteger > & object );
+               const KhalimskySpaceND<dim, TInteger, TCellContainers > & object );
 
 } // namespace DGtal
 
@@ -41,6 +41,7 @@
 // Inclusions
 #include <iostream>
 #include <bitset>
+#include <vector>
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
 #include <DGtal/base/CountedPtr.h>
@@ -114,6 +115,60 @@ namespace DGtal {
   std::unordered_map<TPoint, NeighborhoodConfiguration > >
   mapZeroPointNeighborhoodToConfigurationMask();
 
+  /**
+   * Computes in one pass the neighborhood configuration of every
+   * point of a 2D or 3D binary image, with the bit masks of
+   * mapZeroPointNeighborhoodToConfigurationMask. Points outside the
+   * domain are background.
+   *
+   * The image is first packed into bitplanes (one bit per point, one
+   * row of 64-bit words per line of the domain, with a background
+   * margin). The configurations of a line are then obtained by
+   * sliding the 3x3(x3) window along the 3 (or 9) neighboring rows of
+   * bits. Lines are processed in parallel with OpenMP.
+   *
+   * @code
+   * std::vector< NeighborhoodConfiguration > configurations;
+   * functions::computeNeighborhoodConfigurations( image, configurations );
+   * std::vector< unsigned char > flags;
+   * functions::classifyNeighborhoodConfigurations( configurations, *simpleTable, 1, flags );
+   * functions::classifyNeighborhoodConfigurations( configurations, *isthmusTable, 2, flags );
+   * @endcode
+   *
+   * @tparam TImage a type of image over a 2D or 3D HyperRectDomain,
+   * whose values are converted to bool (true for foreground points).
+   *
+   * @param image the binary image.
+   * @param[out] configurations the configurations of all points of
+   * the domain, in the order of the domain (and of
+   * ImageContainerBySTLVector).
+   */
+  template<typename TImage>
+  inline
+  void
+  computeNeighborhoodConfigurations( const TImage & image,
+                                     std::vector< NeighborhoodConfiguration > & configurations );
+
+  /**
+   * Looks up a table (e.g. simplicity or isthmusicity) for a batch of
+   * neighborhood configurations, in parallel with OpenMP.
+   *
+   * @param configurations any neighborhood configurations, e.g.
+   * computed by computeNeighborhoodConfigurations.
+   * @param table a look up table indexed by configurations.
+   * @param flag the bit(s) to set in flags[i] when table[configurations[i]]
+   * is true, and to clear otherwise. Several tables may thus be
+   * looked up in the same flags.
+   * @param[in,out] flags the classification of each configuration,
+   * resized (with zeros) to the number of configurations if needed.
+   */
+  inline
+  void
+  classifyNeighborhoodConfigurations( const std::vector< NeighborhoodConfiguration > & configurations,
+                                      const boost::dynamic_bitset<> & table,
+                                      const unsigned char flag,
+                                      std::vector< unsigned char > & flags );
+
   } // namespace functions
 } // namespace DGtal
 
@@ -56,6 +56,7 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -413,6 +414,13 @@ namespace DGtal
       Computes the connected components of the object and writes
       them on the output iterator [it].
 
+      When the domain is a HyperRectDomain and the foreground
+      adjacency is a MetricAdjacency, the components are found by a
+      (parallel) union-find labelling of the bounding box of the
+      object (see ConnectedComponentLabelling), otherwise by
+      breadth-first traversals. Components are written in the order
+      of their first point in the point set in both cases.
+
       @tparam OutputObjectIterator the type of an output iterator in
       a container of Object s.
 
@@ -674,6 +682,41 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Tells if the components of the object can be labelled by
+     * ConnectedComponentLabelling, i.e. if the domain is a
+     * HyperRectDomain and the foreground adjacency is translation
+     * invariant.
+     */
+    typedef std::integral_constant< bool,
+      IsTranslationInvariantAdjacency< ForegroundAdjacency >::value
+      && std::is_same< Domain, HyperRectDomain< Space > >::value >
+    LabellingApplies;
+
+    /**
+     * Writes the components found by a union-find labelling of the
+     * bounding box of the object, in the same order as the
+     * breadth-first traversals would. Falls back to the latter when
+     * the object is too sparse within its bounding box.
+     *
+     * @param it the output iterator. *it is an Object.
+     * @return the number of components.
+     */
+    template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it, std::true_type ) const;
+
+    /**
+     * Writes the components found by breadth-first traversals.
+     *
+     * @param it the output iterator. *it is an Object.
+     * @return the number of components.
+     */
+    template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it, std::false_type ) const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
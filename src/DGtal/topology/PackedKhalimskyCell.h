@@ -0,0 +1,362 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskyCell.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedKhalimskyCell.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedKhalimskyCell_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskyCell.h
+#else // defined(PackedKhalimskyCell_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskyCell_RECURSES
+
+#if !defined PackedKhalimskyCell_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskyCell_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents an unsigned cell of a bounded Khalimsky space
+   * packed in one 64-bit integer.
+   *
+   * The Khalimsky coordinates, relative to the origin of the
+   * KhalimskyCellPacker that created the cell, are stored in
+   * consecutive fields of 63/dim bits (21 bits in 3D), the first
+   * coordinate in the lowest bits. Comparison and hashing are those of
+   * the integer code. Cells packed by different packers must not be
+   * mixed.
+   *
+   * @tparam dim the dimension of the space (at most 3).
+   * @see KhalimskyCellPacker
+   */
+  template < Dimension dim >
+  struct PackedKhalimskyCell
+  {
+    BOOST_STATIC_ASSERT(( dim >= 1 && dim <= 3 ));
+    typedef DGtal::uint64_t Code;
+
+    /// The packed Khalimsky coordinates.
+    Code code;
+
+    /// Default constructor (the cell of code 0).
+    PackedKhalimskyCell() : code( 0 ) {}
+    /// Constructor from a code.
+    explicit PackedKhalimskyCell( Code aCode ) : code( aCode ) {}
+
+    bool operator==( const PackedKhalimskyCell & other ) const
+    { return code == other.code; }
+    bool operator!=( const PackedKhalimskyCell & other ) const
+    { return code != other.code; }
+    /// Order of the codes (not the lexicographic order of KhalimskyCell).
+    bool operator<( const PackedKhalimskyCell & other ) const
+    { return code < other.code; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * @brief Represents a signed cell of a bounded Khalimsky space
+   * packed in one 64-bit integer: the coordinates are packed as in
+   * PackedKhalimskyCell and the sign is the highest bit (set when
+   * positive).
+   *
+   * @tparam dim the dimension of the space (at most 3).
+   * @see KhalimskyCellPacker
+   */
+  template < Dimension dim >
+  struct PackedSignedKhalimskyCell
+  {
+    BOOST_STATIC_ASSERT(( dim >= 1 && dim <= 3 ));
+    typedef DGtal::uint64_t Code;
+
+    /// The packed Khalimsky coordinates and sign.
+    Code code;
+
+    /// Default constructor (the cell of code 0).
+    PackedSignedKhalimskyCell() : code( 0 ) {}
+    /// Constructor from a code.
+    explicit PackedSignedKhalimskyCell( Code aCode ) : code( aCode ) {}
+
+    bool operator==( const PackedSignedKhalimskyCell & other ) const
+    { return code == other.code; }
+    bool operator!=( const PackedSignedKhalimskyCell & other ) const
+    { return code != other.code; }
+    /// Order of the codes (not the lexicographic order of SignedKhalimskyCell).
+    bool operator<( const PackedSignedKhalimskyCell & other ) const
+    { return code < other.code; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker
+  /**
+   * Description of template class 'KhalimskyCellPacker' <p>
+   * \brief Aim: Converts the cells of a bounded Khalimsky space of
+   * dimension at most 3 to and from 64-bit packed cells, and computes
+   * the usual incidence operations directly on packed cells.
+   *
+   * A packed cell takes 8 bytes whatever the dimension, against
+   * dim*sizeof(Integer) (+ sign) for KhalimskyCell and
+   * SignedKhalimskyCell. Sets, maps and sorts of packed cells
+   * compare and hash one integer. The incidence operations (uIncident,
+   * sIncident, sDirect, sDirectIncident, ...) are branch-free: they
+   * add or subtract one unit in a field and compute orientations with
+   * a popcount of the parity bits.
+   *
+   * The Khalimsky coordinates of each axis of the space must span
+   * less than 2^(63/dim) values, i.e. at most 2^20 - 1 digital points
+   * per axis in 3D (see fits()). Periodic spaces are not handled and
+   * the incidence operations do not check the bounds of the space.
+   *
+   * @code
+   * typedef KhalimskyCellPacker< Z3i::KSpace > Packer;
+   * Packer packer( K );
+   * std::unordered_set< Packer::PackedSCell > surfels;
+   * surfels.insert( packer.pack( K.sCell( Z3i::Point( 1, 0, 0 ) ) ) );
+   * Z3i::SCell s = packer.unpack( *surfels.begin() );
+   * @endcode
+   *
+   * @tparam TKSpace the Khalimsky space, a model of
+   * CCellularGridSpaceND, e.g. KhalimskySpaceND.
+   */
+  template < typename TKSpace >
+  class KhalimskyCellPacker
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    static const Dimension dimension = KSpace::dimension;
+
+    typedef PackedKhalimskyCell< dimension > PackedCell;
+    typedef PackedSignedKhalimskyCell< dimension > PackedSCell;
+    typedef DGtal::uint64_t Code;
+
+    /// Number of bits per coordinate.
+    static const unsigned int BITS = 63 / dimension;
+    /// Mask of one coordinate field.
+    static const Code FIELD = ( Code( 1 ) << BITS ) - 1;
+    /// Mask of the sign bit.
+    static const Code SIGN = Code( 1 ) << 63;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param K the Khalimsky space whose cells are packed (aliased).
+     * It must be small enough (see fits()).
+     */
+    KhalimskyCellPacker( ConstAlias< KSpace > K );
+
+    /**
+     * @param K any Khalimsky space.
+     * @return 'true' iff the cells of K can be packed.
+     */
+    static bool fits( const KSpace & K );
+
+    // ----------------------- Conversions ------------------------------
+  public:
+
+    /// @return the packed version of the unsigned cell \a c.
+    PackedCell pack( const Cell & c ) const;
+
+    /// @return the packed version of the signed cell \a c.
+    PackedSCell pack( const SCell & c ) const;
+
+    /// @return the unsigned cell of the packed cell \a p.
+    Cell unpack( const PackedCell & p ) const;
+
+    /// @return the signed cell of the packed cell \a p.
+    SCell unpack( const PackedSCell & p ) const;
+
+    /// @return the \a k-th Khalimsky coordinate of \a p.
+    Integer uKCoord( const PackedCell & p, Dimension k ) const;
+
+    /// @return the \a k-th Khalimsky coordinate of \a p.
+    Integer sKCoord( const PackedSCell & p, Dimension k ) const;
+
+    // ----------------------- Cell operations ------------------------------
+  public:
+
+    /// @return the dimension of the cell \a p.
+    static Dimension uDim( const PackedCell & p );
+
+    /// @return the dimension of the cell \a p.
+    static Dimension sDim( const PackedSCell & p );
+
+    /// @return 'true' iff \a p is a surfel (a (dim-1)-cell).
+    static bool uIsSurfel( const PackedCell & p );
+
+    /// @return 'true' iff \a p is a surfel (a (dim-1)-cell).
+    static bool sIsSurfel( const PackedSCell & p );
+
+    /// @return 'true' iff \a p is open along direction \a k.
+    static bool uIsOpen( const PackedCell & p, Dimension k );
+
+    /// @return 'true' iff \a p is open along direction \a k.
+    static bool sIsOpen( const PackedSCell & p, Dimension k );
+
+    /// @return the sign of \a p.
+    static bool sSign( const PackedSCell & p );
+
+    /// @return the cell \a p with the opposite sign.
+    static PackedSCell sOpp( const PackedSCell & p );
+
+    /// @return the cell \a p with the sign \a s.
+    static PackedSCell sSign( const PackedSCell & p, bool s );
+
+    /// @return the unsigned version of \a p.
+    static PackedCell unsigns( const PackedSCell & p );
+
+    /// @return the signed version of \a p, with sign \a s.
+    static PackedSCell signs( const PackedCell & p, bool s );
+
+    /**
+     * @param s a surfel.
+     * @return the orthogonal direction of \a s (its only closed direction).
+     */
+    static Dimension sOrthDir( const PackedSCell & s );
+
+    /**
+     * @param p any cell.
+     * @param k any direction.
+     * @param up if 'true' the incident cell with greater coordinate,
+     * otherwise the one with smaller coordinate.
+     * @return the incident cell of \a p along \a k (like
+     * KhalimskySpaceND::uIncident, but without bound checks).
+     */
+    static PackedCell uIncident( const PackedCell & p, Dimension k, bool up );
+
+    /**
+     * @param p any signed cell.
+     * @param k any direction.
+     * @param up if 'true' the incident cell with greater coordinate,
+     * otherwise the one with smaller coordinate.
+     * @return the signed incident cell of \a p along \a k (like
+     * KhalimskySpaceND::sIncident, but without bound checks).
+     */
+    static PackedSCell sIncident( const PackedSCell & p, Dimension k, bool up );
+
+    /**
+     * @param p any signed cell.
+     * @param k any direction.
+     * @return the direct orientation of \a p along \a k (like
+     * KhalimskySpaceND::sDirect).
+     */
+    static bool sDirect( const PackedSCell & p, Dimension k );
+
+    /// @return the direct incident cell of \a p along \a k.
+    static PackedSCell sDirectIncident( const PackedSCell & p, Dimension k );
+
+    /// @return the indirect incident cell of \a p along \a k.
+    static PackedSCell sIndirectIncident( const PackedSCell & p, Dimension k );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// @return the mask of the parity bits of the fields 0 to k-1.
+    static Code parityMask( Dimension k );
+
+    /// The Khalimsky space whose cells are packed.
+    const KSpace * mySpace;
+    /// Khalimsky coordinates of the (even) origin of the fields.
+    Point myOrigin;
+
+  }; // end of class KhalimskyCellPacker
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellPacker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellPacker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellPacker<TKSpace> & object );
+
+} // namespace DGtal
+
+namespace std {
+  /// Hash of packed unsigned cells (Fibonacci hashing of the code).
+  template < DGtal::Dimension dim >
+  struct hash< DGtal::PackedKhalimskyCell< dim > >
+  {
+    size_t operator()( const DGtal::PackedKhalimskyCell< dim > & p ) const
+    {
+      const DGtal::uint64_t h = p.code * 0x9E3779B97F4A7C15ULL;
+      return static_cast<size_t>( h ^ ( h >> 32 ) );
+    }
+  };
+
+  /// Hash of packed signed cells (Fibonacci hashing of the code).
+  template < DGtal::Dimension dim >
+  struct hash< DGtal::PackedSignedKhalimskyCell< dim > >
+  {
+    size_t operator()( const DGtal::PackedSignedKhalimskyCell< dim > & p ) const
+    {
+      const DGtal::uint64_t h = p.code * 0x9E3779B97F4A7C15ULL;
+      return static_cast<size_t>( h ^ ( h >> 32 ) );
+    }
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskyCell.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskyCell_h
+
+#undef PackedKhalimskyCell_RECURSES
+#endif // else defined(PackedKhalimskyCell_RECURSES)
@@ -0,0 +1,351 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SubfieldThinning.h
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SubfieldThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SubfieldThinning_RECURSES)
+#error Recursive header files inclusion detected in SubfieldThinning.h
+#else // defined(SubfieldThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SubfieldThinning_RECURSES
+
+#if !defined SubfieldThinning_h
+/** Prevents repeated inclusion of headers. */
+#define SubfieldThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <boost/dynamic_bitset.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Lock-free distribution of the items of a vector to several
+     * threads: each call to next() atomically reserves the following
+     * chunk of items.
+     */
+    class ChunkedWorkQueue
+    {
+    public:
+      /**
+       * @param size the number of items.
+       * @param chunk the number of items reserved at once.
+       */
+      ChunkedWorkQueue( std::size_t size, std::size_t chunk )
+        : mySize( size ), myChunk( chunk ), myNext( 0 ) {}
+
+      /**
+       * Reserves the next chunk of items.
+       * @param[out] begin the first reserved item.
+       * @param[out] end the item after the last reserved one.
+       * @return 'false' when all items have been reserved.
+       */
+      bool next( std::size_t & begin, std::size_t & end )
+      {
+        begin = myNext.fetch_add( myChunk, std::memory_order_relaxed );
+        if ( begin >= mySize ) return false;
+        end = std::min( begin + myChunk, mySize );
+        return true;
+      }
+
+    private:
+      const std::size_t mySize;
+      const std::size_t myChunk;
+      std::atomic< std::size_t > myNext;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SubfieldThinning
+  /**
+   * Description of template class 'SubfieldThinning' <p>
+   * \brief Aim: Parallel topology-preserving thinning of a 2D or 3D
+   * digital object by subfields, driven by a look up table of simple
+   * configurations (see NeighborhoodTables.h).
+   *
+   * The points of the domain are split into 2^dim subfields according
+   * to the parities of their coordinates. Two points of the same
+   * subfield are never adjacent (even for the 8 or 26 adjacency), so
+   * that the simplicity of a point does not depend on the removal of
+   * the other points of its subfield: all simple points of a subfield
+   * can be removed at once, in parallel, without changing the
+   * topology. Subfields are thinned in turn until no point is removed.
+   *
+   * Only points whose neighborhood has changed are examined again:
+   * removing a point queues its neighbors in the work queue of their
+   * subfield. Within a subfield pass, threads get chunks of the queue
+   * through a lock-free counter (detail::ChunkedWorkQueue). The result
+   * does not depend on the number of threads.
+   *
+   * An optional skeleton table (e.g. isthmusicity::tableIsthmus)
+   * anchors points when they are examined: anchored points are never
+   * removed afterwards, as the constraint set of
+   * functions::asymetricThinningScheme.
+   *
+   * The object is stored as one byte per point of the domain, with a
+   * margin of one background point.
+   *
+   * @code
+   * auto simple = functions::loadTable( simplicity::tableSimple26_6 );
+   * SubfieldThinning< Z3i::Space > thinning( domain, *simple );
+   * thinning.init( set.begin(), set.end() );
+   * thinning.thin();
+   * Z3i::DigitalSet skeleton( domain );
+   * thinning.writeObject( skeleton );
+   * @endcode
+   *
+   * @tparam TSpace a 2D or 3D digital space.
+   * @see functions::parallelThinningScheme
+   */
+  template <typename TSpace>
+  class SubfieldThinning
+  {
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 2 || TSpace::dimension == 3 ));
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Size Size;
+    typedef HyperRectDomain< Space > Domain;
+    typedef boost::dynamic_bitset<> ConfigMap;
+
+    /// The number of subfields.
+    static const unsigned int nbSubfields = 1u << Space::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object is empty.
+     *
+     * @param aDomain the domain of the object.
+     * @param simplicityTable the table of simple configurations, for
+     * the topology of the object.
+     */
+    SubfieldThinning( const Domain & aDomain,
+                      ConstAlias< ConfigMap > simplicityTable );
+
+    /**
+     * Destructor.
+     */
+    ~SubfieldThinning() = default;
+
+    /**
+     * Sets the table of the configurations that anchor points in the
+     * skeleton.
+     * @param skeletonTable a table indexed by configurations.
+     */
+    void setSkeletonTable( ConstAlias< ConfigMap > skeletonTable );
+
+    /**
+     * Sets the object to the points of the domain satisfying a predicate.
+     * @tparam TPointPredicate a type of functor Point -> bool.
+     * @param isInObject the predicate.
+     */
+    template <typename TPointPredicate>
+    void init( const TPointPredicate & isInObject );
+
+    /**
+     * Sets the object to a range of points of the domain.
+     * @tparam TPointIterator a type of iterator on points.
+     * @param itb the first point.
+     * @param ite the point after the last one.
+     */
+    template <typename TPointIterator>
+    void init( TPointIterator itb, TPointIterator ite );
+
+    /**
+     * Thins the object until no simple point (not anchored) remains.
+     * @param verbose if true, reports the removed points of each round.
+     * @return the number of removed points.
+     */
+    Size thin( bool verbose = false );
+
+    /**
+     * @return the number of points of the object.
+     */
+    Size size() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return 'true' iff p belongs to the object.
+     */
+    bool isInObject( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return 'true' iff p has been anchored by the skeleton table.
+     */
+    bool isAnchored( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the neighborhood configuration of p in the object.
+     */
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /**
+     * Inserts the points of the object in a digital set.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @param[in,out] set the set where points are inserted.
+     */
+    template <typename TDigitalSet>
+    void writeObject( TDigitalSet & set ) const;
+
+    /**
+     * @return the number of subfield passes of the last thinning.
+     */
+    Size nbPasses() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// State bits of a point.
+    enum { IN_OBJECT = 1, ANCHORED = 2, QUEUED = 4 };
+
+    /// The domain.
+    Domain myDomain;
+    /// The strides of the padded grid.
+    std::ptrdiff_t myStrides[ Space::dimension ];
+    /// The state of each point of the padded grid.
+    std::vector< unsigned char > myStates;
+    /// The simplicity table.
+    const ConfigMap * mySimplicityTable;
+    /// The skeleton table, or 0.
+    const ConfigMap * mySkeletonTable;
+    /// The shifts of the neighbors, in the order of the configuration bits.
+    std::vector< std::ptrdiff_t > myNeighborShifts;
+    /// For each neighbor, the subfield change (xor) it induces.
+    std::vector< unsigned int > myNeighborSubfields;
+    /// The points to examine, per subfield.
+    std::vector< std::size_t > myQueues[ nbSubfields ];
+    /// The number of points of the object.
+    Size mySize;
+    /// The number of subfield passes of the last thinning.
+    Size myNbPasses;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * @param p any point of the domain.
+     * @return its index in the padded grid.
+     */
+    std::size_t index( const Point & p ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return its subfield.
+     */
+    static unsigned int subfield( const Point & p );
+
+    /**
+     * @param i the index of a point in the padded grid.
+     * @return its neighborhood configuration.
+     */
+    NeighborhoodConfiguration configurationAt( std::size_t i ) const;
+
+    /**
+     * Queues the points of the object with a background 1-neighbor.
+     */
+    void queueBorder();
+
+    /**
+     * Removes the simple points of the queue of one subfield, in parallel.
+     * @param s the subfield.
+     * @return the number of removed points.
+     */
+    Size thinSubfield( unsigned int s );
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SubfieldThinning ( const SubfieldThinning & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SubfieldThinning & operator= ( const SubfieldThinning & other );
+
+  }; // end of class SubfieldThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SubfieldThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SubfieldThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SubfieldThinning<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SubfieldThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SubfieldThinning_h
+
+#undef SubfieldThinning_RECURSES
+#endif // else defined(SubfieldThinning_RECURSES)
@@ -44,6 +44,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/SubfieldThinning.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
 {
@@ -81,6 +82,50 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Parallel thinning of a voxel complex by subfields (see
+     * SubfieldThinning). All simple voxels of a subfield are removed
+     * at once, in parallel with OpenMP, until no simple voxel remains.
+     * It preserves the topology as asymetricThinningScheme does, but
+     * the skeleton may differ, since voxels are not removed by cliques.
+     * Simplicity is decided by the table of the complex.
+     *
+     * @tparam TComplex a VoxelComplex.
+     * @param vc input complex, with a simplicity table
+     * (vc.isTableLoaded()).
+     * @param verbose if true, reports the progression.
+     *
+     * @return the thinned complex, with the data of the kept voxels.
+     */
+    template < typename TComplex >
+    TComplex
+    parallelThinningScheme(
+       const TComplex & vc ,
+       bool verbose = false
+    );
+
+    /**
+     * Parallel thinning of a voxel complex by subfields, where voxels
+     * whose configuration is set in a skeleton table (e.g.
+     * isthmusicity::tableIsthmus) are kept as soon as they are met.
+     *
+     * @tparam TComplex a VoxelComplex.
+     * @param vc input complex, with a simplicity table
+     * (vc.isTableLoaded()).
+     * @param skelTable the table of configurations to keep.
+     * @param verbose if true, reports the progression.
+     *
+     * @return the thinned complex, with the data of the kept voxels.
+     * @see SubfieldThinning::setSkeletonTable
+     */
+    template < typename TComplex >
+    TComplex
+    parallelThinningScheme(
+       const TComplex & vc ,
+       const typename TComplex::ConfigMap & skelTable,
+       bool verbose = false
+    );
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
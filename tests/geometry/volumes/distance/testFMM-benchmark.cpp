@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Timings of FMM propagations from the center of a 3D domain with
+ * the different candidate queues.
+ *
+ * Usage: testFMM-benchmark [side]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class FMM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the L2 distance to the center of a cubic domain of side
+ * aSide, with an image, a set of accepted points and a queue of
+ * candidate points of given types.
+ */
+template <typename Image, typename Set, typename Queue>
+bool runATest( const std::string &aName, int aSide )
+{
+  typedef Z3i::Domain Domain;
+  typedef L2FirstOrderLocalDistance<Image, Set> Distance;
+  typedef FMM<Image, Set, functors::DomainPredicate<Domain>, Distance, Queue> FastMarching;
+
+  const Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( aSide - 1 ) );
+  const functors::DomainPredicate<Domain> predicate( domain );
+  Image image( domain );
+  Set set( domain );
+  set.insert( Z3i::Point::diagonal( aSide / 2 ) );
+  image.setValue( Z3i::Point::diagonal( aSide / 2 ), 0.0 );
+  Distance distance( image, set );
+
+  trace.beginBlock( aName );
+  FastMarching fmm( image, set, predicate, distance );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  trace.endBlock();
+
+  return set.size() == domain.size();
+}
+
+/**
+ * Same as runATest, for images of type ImageContainerBySTLMap, whose
+ * accepted points are given by DigitalSetFromMap.
+ */
+template <typename Queue>
+bool runAMapTest( const std::string &aName, int aSide )
+{
+  typedef Z3i::Domain Domain;
+  typedef ImageContainerBySTLMap<Domain, double> Image;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef L2FirstOrderLocalDistance<Image, Set> Distance;
+  typedef FMM<Image, Set, functors::DomainPredicate<Domain>, Distance, Queue> FastMarching;
+
+  const Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( aSide - 1 ) );
+  const functors::DomainPredicate<Domain> predicate( domain );
+  Image image( domain, 0.0 );
+  image.setValue( Z3i::Point::diagonal( aSide / 2 ), 0.0 );
+  Set set( image );
+  Distance distance( image, set );
+
+  trace.beginBlock( aName );
+  FastMarching fmm( image, set, predicate, distance );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  trace.endBlock();
+
+  return set.size() == domain.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class FMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int side = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 96;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+  typedef DigitalSetByBitset<Z3i::Domain> Set;
+  typedef ImageContainerBySTLMap<Z3i::Domain, double> MapImage;
+  typedef DigitalSetFromMap<MapImage> MapSet;
+
+  bool res = runAMapTest< SetCandidateQueue<MapSet, double> >( "map, set queue", side )
+    && runAMapTest< IndexedHeapCandidateQueue<MapSet, double> >( "map, indexed heap", side )
+    && runAMapTest< UntidyBucketCandidateQueue<MapSet, double> >( "map, untidy buckets", side )
+    && runATest< Image, Set, SetCandidateQueue<Set, double> >( "vector, set queue", side )
+    && runATest< Image, Set, IndexedHeapCandidateQueue<Set, double> >( "vector, indexed heap", side )
+    && runATest< Image, Set, UntidyBucketCandidateQueue<Set, double> >( "vector, untidy buckets", side );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
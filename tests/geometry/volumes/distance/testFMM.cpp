@@ -653,6 +653,89 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Runs FMM from the center of a domain with a given candidate queue
+ * and returns the distance values of the domain points.
+ */
+template <typename Domain, typename Distance, typename Queue>
+std::vector<double> runFMMWithQueue(const Domain& d)
+{
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set; 
+  typedef typename Domain::Point Point; 
+
+  Image map( d, 0.0 ); 
+  map.setValue( Point::diagonal(0), 0.0 );
+  Set set(map); 
+  DomainPredicate<Domain> dp(d);
+  Distance distance(map, set); 
+
+  FMM<Image, Set, DomainPredicate<Domain>, Distance, Queue> fmm( map, set, dp, distance ); 
+  fmm.compute(); 
+  trace.info() << fmm << std::endl; 
+
+  std::vector<double> values; 
+  for (typename Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    values.push_back( (set.find(*it) == set.end()) ? -1.0 : map(*it) ); 
+  return values; 
+}
+
+/**
+ * Compares the distance values computed with the candidate queues
+ * to the ones computed with the default queue: the values must be
+ * equal, up to @a aBucketError for the untidy bucket queue.
+ */
+template <Dimension dimension, typename Distance>
+bool testCandidateQueues(int size, double aBucketError)
+{
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef typename Domain::Point Point; 
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+  trace.beginBlock ( "Candidate queues" );
+  const std::vector<double> reference
+    = runFMMWithQueue<Domain, Distance, SetCandidateQueue<Set, double> >( d ); 
+  const std::vector<double> heap
+    = runFMMWithQueue<Domain, Distance, IndexedHeapCandidateQueue<Set, double> >( d ); 
+  const std::vector<double> buckets
+    = runFMMWithQueue<Domain, Distance, UntidyBucketCandidateQueue<Set, double> >( d ); 
+  // 10 buckets per unit: the bucket array size is not 4*10 but 64.
+  const std::vector<double> buckets10
+    = runFMMWithQueue<Domain, Distance, UntidyBucketCandidateQueue<Set, double, 10> >( d ); 
+
+  unsigned int nbok = 0; 
+  unsigned int nb = 0; 
+  double heapError = 0.0, bucketError = 0.0, bucket10Error = 0.0; 
+  bool accepted = true; 
+  for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+      accepted = accepted && ( reference[i] >= 0 ) && ( heap[i] >= 0 ) && ( buckets[i] >= 0 )
+        && ( buckets10[i] >= 0 ); 
+      heapError = std::max( heapError, std::abs( heap[i] - reference[i] ) ); 
+      bucketError = std::max( bucketError, std::abs( buckets[i] - reference[i] ) ); 
+      bucket10Error = std::max( bucket10Error, std::abs( buckets10[i] - reference[i] ) ); 
+    }
+  nbok += accepted ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") all points accepted" << std::endl; 
+  nbok += ( heapError < 1e-9 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") indexed heap error " << heapError << std::endl; 
+  nbok += ( bucketError <= aBucketError ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") untidy bucket error " << bucketError << std::endl; 
+  // The error is bounded by the bucket width, 1.6 times larger.
+  nbok += ( bucket10Error <= 1.6 * aBucketError ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") untidy bucket error (10 per unit) " << bucket10Error << std::endl; 
+  trace.endBlock();
+
+  return nbok == nb; 
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -693,6 +776,17 @@ int main ( int argc, char** argv )
     && testComparison<4,1>( size, area, 4*size+1 )
     ;
 
+  //candidate queues
+  typedef HyperRectDomain< SpaceND<2, int> > Domain2; 
+  typedef HyperRectDomain< SpaceND<3, int> > Domain3; 
+  typedef ImageContainerBySTLMap<Domain2,double> Image2; 
+  typedef ImageContainerBySTLMap<Domain3,double> Image3; 
+  res = res
+    && testCandidateQueues<2, L2FirstOrderLocalDistance<Image2, DigitalSetFromMap<Image2> > >( 50, 0.1 )
+    && testCandidateQueues<3, L2FirstOrderLocalDistance<Image3, DigitalSetFromMap<Image3> > >( 15, 0.1 )
+    && testCandidateQueues<3, L1LocalDistance<Image3, DigitalSetFromMap<Image3> > >( 15, 0.0 )
+    ;
+
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
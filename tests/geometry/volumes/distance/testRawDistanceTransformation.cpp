@@ -0,0 +1,263 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRawDistanceTransformation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class RawDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/RawDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class RawDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testCheckConcept()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,2> L2Metric;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< RawDistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> >));
+
+  return true;
+}
+
+/**
+ * Set of the domain points, without the sites, chosen at random
+ * with probability 1/aRatio.
+ */
+template <typename Domain, typename Set>
+void randomSet( const Domain &aDomain, Set &aSet, int aRatio )
+{
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itend = aDomain.end();
+        it != itend; ++it )
+    if ( rand() % aRatio != 0 )
+      aSet.insertNew( *it );
+}
+
+/**
+ * Compares the raw distances to the ones of the Voronoi vectors
+ * of DistanceTransformation.
+ */
+template <typename Image, typename Metric, typename Set>
+bool compareWithDistanceTransformation( const Set &aSet, const Metric &aMetric,
+                                        const std::array<bool, Set::Space::dimension> &aPeriodicity,
+                                        const std::string &aName )
+{
+  typedef typename Set::Space Space;
+  typedef typename Set::Domain Domain;
+  typedef DistanceTransformation<Space, Set, Metric> DT;
+  typedef RawDistanceTransformation<Space, Set, Metric, Image> RawDT;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Comparing with DistanceTransformation: " + aName );
+
+  const Domain & domain = aSet.domain();
+  DT dt( &domain, &aSet, &aMetric, aPeriodicity );
+  RawDT rawDT( &domain, &aSet, &aMetric, aPeriodicity );
+
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const double expected = NumberTraits<typename Metric::RawValue>::castToDouble
+        ( aMetric.rawDistance( *it, dt.getVoronoiVector( *it ) ) );
+      const double value = static_cast<double>( rawDT( *it ) );
+      if ( std::abs( value - expected ) <= 1e-9 * expected )
+        nbok++;
+      else
+        trace.error() << "At " << *it << " got " << value << " instead of " << expected << std::endl;
+      nb++;
+    }
+
+  trace.info() << rawDT << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testRandom2D()
+{
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 1> L1Metric;
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 3> L3Metric;
+  typedef ImageContainerBySTLVector<Z2i::Domain, DGtal::uint32_t> UIntImage;
+  typedef ImageContainerBySTLVector<Z2i::Domain, float> FloatImage;
+  typedef ImageContainerBySTLVector<Z2i::Domain, DGtal::int64_t> LongImage;
+
+  Z2i::Domain domain( Z2i::Point( -20, -13 ), Z2i::Point( 25, 30 ) );
+  Z2i::DigitalSet set( domain );
+  srand( 0 );
+  randomSet( domain, set, 50 );
+
+  const L2Metric l2;
+  const L1Metric l1;
+  const L3Metric l3;
+  const std::array<bool, 2> none = { {false, false} };
+  const std::array<bool, 2> first = { {true, false} };
+  const std::array<bool, 2> second = { {false, true} };
+  const std::array<bool, 2> both = { {true, true} };
+
+  return compareWithDistanceTransformation<UIntImage>( set, l2, none, "2D l2 uint32" )
+    && compareWithDistanceTransformation<FloatImage>( set, l2, none, "2D l2 float" )
+    && compareWithDistanceTransformation<UIntImage>( set, l1, none, "2D l1 uint32" )
+    && compareWithDistanceTransformation<LongImage>( set, l3, none, "2D l3 int64" )
+    && compareWithDistanceTransformation<UIntImage>( set, l2, first, "2D l2 periodic x" )
+    && compareWithDistanceTransformation<UIntImage>( set, l2, second, "2D l2 periodic y" )
+    && compareWithDistanceTransformation<UIntImage>( set, l2, both, "2D l2 periodic xy" )
+    && compareWithDistanceTransformation<LongImage>( set, l3, both, "2D l3 periodic xy" );
+}
+
+bool testRandom3D()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 1> L1Metric;
+  typedef InexactPredicateLpSeparableMetric<Z3i::Space> LpMetric;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> UIntImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> DoubleImage;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 13, 17 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 1 );
+  randomSet( domain, set, 300 );
+
+  const L2Metric l2;
+  const L1Metric l1;
+  const LpMetric l25( 2.5 );
+  const std::array<bool, 3> none = { {false, false, false} };
+  const std::array<bool, 3> some = { {true, false, true} };
+
+  return compareWithDistanceTransformation<UIntImage>( set, l2, none, "3D l2" )
+    && compareWithDistanceTransformation<UIntImage>( set, l1, none, "3D l1" )
+    && compareWithDistanceTransformation<DoubleImage>( set, l25, none, "3D inexact l2.5" )
+    && compareWithDistanceTransformation<UIntImage>( set, l2, some, "3D l2 periodic xz" );
+}
+
+bool testNoSite()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing a domain without sites" );
+
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  typedef RawDistanceTransformation<Z2i::Space, Z2i::DigitalSet, L2Metric> RawDT;
+
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 10, 5 ) );
+  Z2i::DigitalSet set( domain );
+  set.assignFromComplement( Z2i::DigitalSet( domain ) );
+  const L2Metric l2;
+  RawDT rawDT( &domain, &set, &l2 );
+
+  for ( auto const & p : domain )
+    {
+      nbok += ( rawDT( p ) == RawDT::infinity() ) ? 1 : 0;
+      nb++;
+    }
+
+  // A single site.
+  set.erase( Z2i::Point( 3, 2 ) );
+  RawDT rawDT2( &domain, &set, &l2 );
+  nbok += ( rawDT2( Z2i::Point( 10, 5 ) ) == 7*7 + 3*3 ) ? 1 : 0;
+  nb++;
+  nbok += ( rawDT2( Z2i::Point( 3, 2 ) ) == 0 ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testSaturation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing raw distances beyond the image value range" );
+
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric;
+  typedef RawDistanceTransformation<Z2i::Space, Z2i::DigitalSet, L2Metric> RawDT;
+
+  // Squared distances up to 70000^2 > 2^32 along a row, with a site at 0.
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 70000, 1 ) );
+  Z2i::DigitalSet set( domain );
+  set.assignFromComplement( Z2i::DigitalSet( domain ) );
+  set.erase( Z2i::Point( 0, 0 ) );
+  const L2Metric l2;
+  RawDT rawDT( &domain, &set, &l2 );
+
+  nbok += ( rawDT( Z2i::Point( 65535, 0 ) ) == 65535u*65535u ) ? 1 : 0;
+  nb++;
+  nbok += ( rawDT( Z2i::Point( 65536, 0 ) ) == RawDT::infinity() - 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( rawDT( Z2i::Point( 70000, 1 ) ) == RawDT::infinity() - 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( rawDT( Z2i::Point( 1000, 1 ) ) == 1000u*1000u + 1 ) ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class RawDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCheckConcept()
+    && testNoSite()
+    && testSaturation()
+    && testRandom2D()
+    && testRandom3D()
+    ; // && ... other tests
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTiledRawDistanceTransformation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class TiledRawDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <array>
+#include <cstdlib>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/RawDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/TiledRawDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TiledRawDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Tiled image with a write-back cache of aCacheSize tiles over an
+ * image container.
+ */
+template <typename TImage>
+struct Tiled
+{
+  typedef ImageFactoryFromImage<TImage> Factory;
+  typedef typename Factory::OutputImage OutputImage;
+  typedef ImageCacheReadPolicyFIFO<OutputImage, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWB<OutputImage, Factory> WritePolicy;
+  typedef TiledImage<TImage, Factory, ReadPolicy, WritePolicy> Image;
+
+  Tiled( TImage & anImage, int aCacheSize, int aNbTiles )
+    : factory( anImage ), readPolicy( factory, aCacheSize ), writePolicy( factory ),
+      image( factory, readPolicy, writePolicy, aNbTiles )
+  {}
+
+  Factory factory;
+  ReadPolicy readPolicy;
+  WritePolicy writePolicy;
+  Image image;
+};
+
+bool testCheckConcept()
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+  typedef functors::SimpleThresholdForegroundPredicate<Image> Predicate;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage<
+                         TiledRawDistanceTransformation< Predicate, Z3i::L2Metric,
+                         Tiled<Image>::Image > > ));
+
+  return true;
+}
+
+/**
+ * Compares the raw distances computed in a tiled image to the ones
+ * of RawDistanceTransformation, for random sites (one point out of
+ * aRatio) of a binary image, possibly tiled too.
+ */
+template <typename Metric, typename Domain>
+bool compareWithRawDistanceTransformation( const Domain &aDomain, int aRatio, int aNbTiles,
+                                           bool aTiledInput, const Metric &aMetric,
+                                           const std::array<bool, Domain::dimension> &aPeriodicity,
+                                           const std::string &aName )
+{
+  typedef typename Domain::Space Space;
+  typedef ImageContainerBySTLVector<Domain, unsigned char> BinaryImage;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint32_t> Image;
+  typedef typename Tiled<BinaryImage>::Image TiledBinaryImage;
+  typedef functors::SimpleThresholdForegroundPredicate<BinaryImage> Predicate;
+  typedef functors::SimpleThresholdForegroundPredicate<TiledBinaryImage> TiledPredicate;
+  typedef RawDistanceTransformation<Space, Predicate, Metric, Image> RawDT;
+  typedef TiledRawDistanceTransformation<Predicate, Metric, typename Tiled<Image>::Image> TiledDT;
+  typedef TiledRawDistanceTransformation<TiledPredicate, Metric, typename Tiled<Image>::Image> TiledInputDT;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Comparing with RawDistanceTransformation: " + aName );
+
+  BinaryImage binary( aDomain );
+  for ( auto const & p : aDomain )
+    binary.setValue( p, ( rand() % aRatio == 0 ) ? 0 : 1 );
+  const Predicate predicate( binary, 0 );
+  const RawDT rawDT( &aDomain, &predicate, &aMetric, aPeriodicity );
+
+  Image output( aDomain );
+  Tiled<Image> tiled( output, 2, aNbTiles );
+  if ( aTiledInput )
+    {
+      Tiled<BinaryImage> tiledBinary( binary, 2, aNbTiles );
+      const TiledPredicate tiledPredicate( tiledBinary.image, 0 );
+      const TiledInputDT tiledDT( tiled.image, tiledPredicate, aMetric, aPeriodicity );
+      trace.info() << tiledDT << std::endl;
+    }
+  else
+    {
+      const TiledDT tiledDT( tiled.image, predicate, aMetric, aPeriodicity );
+      trace.info() << tiledDT << std::endl;
+    }
+
+  // The write-back cache still holds distances: the output image is up to date once flushed.
+  tiled.image.flushCache();
+  bool flushed = true;
+  for ( auto const & p : aDomain )
+    flushed = flushed && ( output( p ) == rawDT( p ) );
+  nbok += flushed ? 1 : 0;
+  nb++;
+
+  for ( auto const & p : aDomain )
+    {
+      if ( tiled.image( p ) == rawDT( p ) )
+        nbok++;
+      else
+        trace.error() << "At " << p << " got " << tiled.image( p ) << " instead of " << rawDT( p ) << std::endl;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") cache misses="
+               << tiled.image.getCacheMissRead() + tiled.image.getCacheMissWrite() << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testTiled2D()
+{
+  srand( 0 );
+  const Z2i::Domain domain( Z2i::Point( -10, 3 ), Z2i::Point( 29, 38 ) );
+  // 11x9: the tile widths do not divide the extents
+  const Z2i::Domain trailing( Z2i::Point( -3, 2 ), Z2i::Point( 7, 10 ) );
+  const std::array<bool, 2> none = { {false, false} };
+  const std::array<bool, 2> both = { {true, true} };
+
+  return compareWithRawDistanceTransformation( domain, 40, 4, false, Z2i::l2Metric, none, "2D l2" )
+    && compareWithRawDistanceTransformation( domain, 40, 4, true, Z2i::l1Metric, none, "2D l1 tiled input" )
+    && compareWithRawDistanceTransformation( domain, 40, 4, false, Z2i::l2Metric, both, "2D l2 periodic" )
+    && compareWithRawDistanceTransformation( trailing, 10, 4, false, Z2i::l2Metric, none, "2D l2, trailing tiles" )
+    && compareWithRawDistanceTransformation( trailing, 10, 6, true, Z2i::l1Metric, both, "2D l1 periodic, trailing tiles" );
+}
+
+bool testTiled3D()
+{
+  srand( 1 );
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 23, 17, 29 ) );
+  const Z3i::Domain cube( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 31, 31 ) );
+  const Z3i::Domain trailing( Z3i::Point( 0, 0, 0 ), Z3i::Point( 10, 13, 8 ) );
+  const std::array<bool, 3> none = { {false, false, false} };
+  const std::array<bool, 3> some = { {false, true, true} };
+
+  return compareWithRawDistanceTransformation( domain, 200, 3, false, Z3i::l2Metric, none, "3D l2" )
+    && compareWithRawDistanceTransformation( domain, 200, 3, true, Z3i::l2Metric, some, "3D l2 periodic yz, tiled input" )
+    && compareWithRawDistanceTransformation( cube, 2000, 4, false, Z3i::l1Metric, none, "3D l1 sparse" )
+    && compareWithRawDistanceTransformation( trailing, 50, 4, false, Z3i::l2Metric, some, "3D l2 periodic yz, trailing tiles" );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class TiledRawDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCheckConcept()
+    && testTiled2D()
+    && testTiled3D()
+    ; // && ... other tests
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Timings of VoronoiMap constructions on 2D and 3D random sites,
+ * for several metrics and periodicities, and of the updates of an
+ * updatable map after some sites are added or removed.
+ *
+ * Usage: testVoronoiMap-benchmark [side2D] [side3D]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <array>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the Voronoi map of random sites (one point out of
+ * aRatio) on a cubic domain of side aSide.
+ */
+template <typename Space, typename Metric>
+bool runATest( const std::string &aName, int aSide, int aRatio,
+               const std::array<bool, Space::dimension> &aPeriodicity )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef functors::SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef VoronoiMap<Space, Predicate, Metric> Voronoi;
+
+  const Domain domain( Domain::Point::diagonal( 0 ), Domain::Point::diagonal( aSide - 1 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    image.setValue( p, ( rand() % aRatio == 0 ) ? 0 : 1 );
+  const Predicate predicate( image, 0 );
+  const Metric metric;
+
+  trace.beginBlock( aName );
+  Voronoi voronoi( &domain, &predicate, &metric, aPeriodicity );
+  trace.endBlock();
+
+  return voronoi.domain().isValid();
+}
+
+/**
+ * Updates the Voronoi map of random sites (one point out of aRatio)
+ * on a cubic domain of side aSide after batches of random edits, and
+ * compares with full recomputations.
+ */
+template <typename Space, typename Metric>
+bool runAnUpdateTest( const std::string &aName, int aSide, int aRatio )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef functors::SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef VoronoiMap<Space, Predicate, Metric> Voronoi;
+
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( aSide - 1 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto const & p : domain )
+    image.setValue( p, ( rand() % aRatio == 0 ) ? 0 : 1 );
+  const Predicate predicate( image, 0 );
+  const Metric metric;
+  typename Voronoi::PeriodicitySpec periodicity;
+  periodicity.fill( false );
+
+  trace.beginBlock( aName );
+  Voronoi voronoi( &domain, &predicate, &metric, periodicity, true );
+  for ( unsigned int nbEdits = 1; nbEdits <= 10000; nbEdits *= 10 )
+    {
+      std::vector<Point> edits;
+      for ( unsigned int i = 0; i < nbEdits; ++i )
+        {
+          Point p;
+          for ( Dimension k = 0; k < Space::dimension; ++k )
+            p[ k ] = rand() % aSide;
+          image.setValue( p, 1 - image( p ) );
+          edits.push_back( p );
+        }
+
+      Clock c;
+      c.startClock();
+      voronoi.update( edits.begin(), edits.end() );
+      const double update = c.stopClock();
+      c.startClock();
+      Voronoi full( &domain, &predicate, &metric, periodicity );
+      const double recompute = c.stopClock();
+      trace.info() << nbEdits << " edits: update " << update << " ms,"
+                   << " recompute " << recompute << " ms" << std::endl;
+    }
+  trace.endBlock();
+
+  return voronoi.domain().isValid();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int side2D = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 2048;
+  const int side3D = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 256;
+
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 1> L1Metric2D;
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 2> L2Metric2D;
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 3> L3Metric2D;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 1> L1Metric3D;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric3D;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 3> L3Metric3D;
+  const std::array<bool, 2> none2D = { {false, false} };
+  const std::array<bool, 2> periodic2D = { {true, true} };
+  const std::array<bool, 3> none3D = { {false, false, false} };
+  const std::array<bool, 3> periodic3D = { {true, true, true} };
+
+  bool res = runATest<Z2i::Space, L2Metric2D>( "2D l2", side2D, 1000, none2D )
+    && runATest<Z2i::Space, L1Metric2D>( "2D l1", side2D, 1000, none2D )
+    && runATest<Z2i::Space, L3Metric2D>( "2D l3", side2D, 1000, none2D )
+    && runATest<Z2i::Space, L2Metric2D>( "2D l2 periodic", side2D, 1000, periodic2D )
+    && runATest<Z3i::Space, L2Metric3D>( "3D l2", side3D, 1000, none3D )
+    && runATest<Z3i::Space, L1Metric3D>( "3D l1", side3D, 1000, none3D )
+    && runATest<Z3i::Space, L3Metric3D>( "3D l3", side3D, 1000, none3D )
+    && runATest<Z3i::Space, L2Metric3D>( "3D l2 periodic", side3D, 1000, periodic3D )
+    && runAnUpdateTest<Z2i::Space, L2Metric2D>( "2D l2 updates", side2D, 1000 )
+    && runAnUpdateTest<Z3i::Space, L2Metric3D>( "3D l2 updates", side3D, 1000 );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <iostream>
 #include <array>
 #include <algorithm>
+#include <memory>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -674,6 +675,102 @@ bool testSimple4D()
   return ok;
 }
 
+/** Toggles random points of a set, updates an updatable Voronoi map
+ * and distance transformation accordingly, and compares them with new
+ * constructions.
+ */
+template < typename Space >
+bool testUpdates( std::array<bool, Space::dimension> const & periodicity )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLVector<Domain> Set;
+  typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+  typedef VoronoiMap<Space, Set, L2Metric> Voro;
+  typedef DistanceTransformation<Space, Set, L2Metric> DT;
+
+  const Point a = Point::diagonal( 0 );
+  const Point b = Point::diagonal( Space::dimension == 2 ? 31 : 11 );
+  const Domain domain( a, b );
+  const L2Metric l2;
+
+  // The set is the complement of the sites.
+  Set set( domain );
+  for ( auto const & pt : domain )
+    if ( rand() % 50 != 0 )
+      set.insertNew( pt );
+
+  // Without periodic dimension, the non-periodic constructors are used.
+  const bool periodic = std::find( periodicity.begin(), periodicity.end(), true ) != periodicity.end();
+  std::unique_ptr<Voro> voroPtr( periodic ? new Voro( domain, set, l2, periodicity, true )
+                                          : new Voro( domain, set, l2, true ) );
+  std::unique_ptr<DT> dtPtr( periodic ? new DT( domain, set, l2, periodicity, true )
+                                      : new DT( domain, set, l2, true ) );
+  Voro & voro = *voroPtr;
+  DT & dt = *dtPtr;
+  if ( ! voro.isUpdatable() || ! dt.isUpdatable() )
+    {
+      trace.error() << "Maps are not updatable." << std::endl;
+      return false;
+    }
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  for ( unsigned int nbEdits = 1; nbEdits <= 64; nbEdits *= 4 )
+    {
+      std::vector<Point> edits;
+      for ( unsigned int i = 0; i < nbEdits; ++i )
+        {
+          Point p;
+          for ( Dimension k = 0; k < Space::dimension; ++k )
+            p[ k ] = rand() % ( b[ k ] + 1 );
+          if ( set( p ) )
+            set.erase( p );
+          else
+            set.insertNew( p );
+          edits.push_back( p );
+        }
+
+      voro.update( edits.begin(), edits.end() );
+      dt.update( edits.begin(), edits.end() );
+      const Voro reference( domain, set, l2, periodicity );
+
+      bool same = true;
+      for ( auto const & pt : domain )
+        same = same && voro( pt ) == reference( pt )
+          && dt( pt ) == l2( pt, reference( pt ) );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << nbEdits << " edits" << std::endl;
+    }
+
+  return nbok == nb;
+}
+
+bool testUpdates()
+{
+  bool ok = true;
+
+  for ( std::size_t i = 0; i < 4; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<2>(i);
+      trace.beginBlock( "Updates 2D with periodicity " + formatPeriodicity(periodicity) );
+      ok = ok && testUpdates<Z2i::Space>( periodicity );
+      trace.endBlock();
+    }
+
+  for ( std::size_t i = 0; i < 8; i += 7 )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Updates 3D with periodicity " + formatPeriodicity(periodicity) );
+      ok = ok && testUpdates<Z3i::Space>( periodicity );
+      trace.endBlock();
+    }
+
+  return ok;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -696,6 +793,7 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testUpdates()
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Stencil benchmarks of ImageContainerByBricks against
+ * ImageContainerBySTLVector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> ImageVector3;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, DGtal::int32_t> ImageBricks3;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, DGtal::int32_t, 2> ImageBricks3Small;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, DGtal::int32_t, 4> ImageBricks3Large;
+
+/// Image of side state.range(0) filled with pseudo-random values.
+template<typename Q>
+static Q makeImage(benchmark::State& state)
+{
+  typename Q::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0) - 1));
+  Q image( dom );
+  srand( 0 );
+  for(typename Q::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it)
+    image.setValue( *it, rand() % 256 );
+  return image;
+}
+
+/// Sum of the 26-neighborhood of the interior points, in domain order.
+template<typename Q>
+static void BM_Stencil26(benchmark::State& state)
+{
+  const Q image = makeImage<Q>( state );
+  const Z3i::Domain interior( image.domain().lowerBound() + Z3i::Point::diagonal(1),
+                              image.domain().upperBound() - Z3i::Point::diagonal(1) );
+  while (state.KeepRunning())
+    {
+      DGtal::int64_t sum = 0;
+      for(Z3i::Domain::ConstIterator it = interior.begin(), itend = interior.end(); it != itend; ++it)
+        for(int z = -1; z <= 1; ++z)
+          for(int y = -1; y <= 1; ++y)
+            for(int x = -1; x <= 1; ++x)
+              sum += image( *it + Z3i::Point( x, y, z ) );
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * interior.size() );
+}
+BENCHMARK_TEMPLATE(BM_Stencil26, ImageVector3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil26, ImageBricks3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil26, ImageBricks3Small)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Sum of the 6-neighborhood of points visited in random order
+/// (e.g. front propagation).
+template<typename Q>
+static void BM_Stencil6Random(benchmark::State& state)
+{
+  const Q image = makeImage<Q>( state );
+  const int side = static_cast<int>( state.range(0) );
+  std::vector<Z3i::Point> points;
+  for(unsigned int i = 0; i < 1000000; ++i)
+    points.push_back( Z3i::Point( 1 + rand() % (side - 2), 1 + rand() % (side - 2), 1 + rand() % (side - 2) ) );
+  while (state.KeepRunning())
+    {
+      DGtal::int64_t sum = 0;
+      for(std::vector<Z3i::Point>::const_iterator it = points.begin(), itend = points.end(); it != itend; ++it)
+        {
+          sum += image( *it );
+          for(Dimension k = 0; k < 3; ++k)
+            sum += image( *it + Z3i::Point::base(k) ) + image( *it - Z3i::Point::base(k) );
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * points.size() );
+}
+BENCHMARK_TEMPLATE(BM_Stencil6Random, ImageVector3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil6Random, ImageBricks3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// 3-tap filter along the last dimension, scanning lines along this
+/// dimension (e.g. the last pass of a separable filter).
+template<typename Q>
+static void BM_LineScanZ(benchmark::State& state)
+{
+  const Q image = makeImage<Q>( state );
+  const int side = static_cast<int>( state.range(0) );
+  while (state.KeepRunning())
+    {
+      DGtal::int64_t sum = 0;
+      for(int y = 0; y < side; ++y)
+        for(int x = 0; x < side; ++x)
+          for(int z = 1; z < side - 1; ++z)
+            sum += image( Z3i::Point( x, y, z - 1 ) ) + 2 * image( Z3i::Point( x, y, z ) )
+              + image( Z3i::Point( x, y, z + 1 ) );
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK_TEMPLATE(BM_LineScanZ, ImageVector3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_LineScanZ, ImageBricks3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Sum of the 26-neighborhood of the interior points, brick by
+/// brick: stride offsets from the brick values inside the bricks,
+/// point accesses on their borders.
+template<typename Q>
+static void BM_Stencil26ByBricks(benchmark::State& state)
+{
+  const Q image = makeImage<Q>( state );
+  const Z3i::Domain & dom = image.domain();
+  const int side = static_cast<int>( Q::brickSide );
+  std::vector<std::ptrdiff_t> offsets;
+  for(int z = -1; z <= 1; ++z)
+    for(int y = -1; y <= 1; ++y)
+      for(int x = -1; x <= 1; ++x)
+        offsets.push_back( x * (std::ptrdiff_t) Q::stride(0) + y * (std::ptrdiff_t) Q::stride(1)
+                           + z * (std::ptrdiff_t) Q::stride(2) );
+  while (state.KeepRunning())
+    {
+      DGtal::int64_t sum = 0;
+      for(typename Q::Size i = 0; i < image.nbBricks(); ++i)
+        {
+          const Z3i::Domain brick = image.brickDomain( i );
+          const typename Q::Value * values = image.brickValues( i );
+          for(Z3i::Domain::ConstIterator it = brick.begin(), itend = brick.end(); it != itend; ++it)
+            {
+              const Z3i::Point p = *it;
+              const Z3i::Point local = p - brick.lowerBound();
+              if ( local[0] > 0 && local[0] < side - 1 && local[1] > 0 && local[1] < side - 1
+                   && local[2] > 0 && local[2] < side - 1 && image.isInsideBrick( p ) )
+                {
+                  const typename Q::Value * center = values + local[0] + side * ( local[1] + side * local[2] );
+                  for(std::size_t j = 0; j < offsets.size(); ++j)
+                    sum += center[ offsets[ j ] ];
+                }
+              else if ( dom.isInside( p - Z3i::Point::diagonal(1) )
+                        && dom.isInside( p + Z3i::Point::diagonal(1) ) )
+                for(int z = -1; z <= 1; ++z)
+                  for(int y = -1; y <= 1; ++y)
+                    for(int x = -1; x <= 1; ++x)
+                      sum += image( p + Z3i::Point( x, y, z ) );
+            }
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * dom.size() );
+}
+BENCHMARK_TEMPLATE(BM_Stencil26ByBricks, ImageBricks3)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil26ByBricks, ImageBricks3Large)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
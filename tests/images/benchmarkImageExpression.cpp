@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkImageExpression.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks of image expressions against adapters and point loops.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageExpression.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, unsigned char> Image;
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, float> FloatImage;
+typedef functors::Thresholder<unsigned char, false, false> Greater;
+typedef ConstImageAdapter< Image, Z3i::Domain, functors::Identity, bool, Greater > ThresholdAdapter;
+typedef ConstImageAdapter< ThresholdAdapter, Z3i::Domain, functors::Identity, unsigned char,
+                           functors::Cast<unsigned char> > CastAdapter;
+
+/// Image of side state.range(0) filled with pseudo-random values.
+template <typename TImage>
+static TImage makeImage(benchmark::State& state, unsigned int seed)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0) - 1));
+  TImage image( dom );
+  srand( seed );
+  for(Z3i::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it)
+    image.setValue( *it, rand() % 256 );
+  return image;
+}
+
+/// Threshold then cast with nested adapters, written with imageFromImage.
+static void BM_ThresholdAdapters(benchmark::State& state)
+{
+  const Image image = makeImage<Image>( state, 0 );
+  functors::Identity id;
+  const Greater greater( 128 );
+  const functors::Cast<unsigned char> cast;
+  const ThresholdAdapter threshold( image, image.domain(), id, greater );
+  const CastAdapter binary( threshold, image.domain(), id, cast );
+  Image result( image.domain() );
+  while (state.KeepRunning())
+    {
+      imageFromImage( result, binary );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_ThresholdAdapters)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Threshold then cast with an expression.
+static void BM_ThresholdExpression(benchmark::State& state)
+{
+  const Image image = makeImage<Image>( state, 0 );
+  Image result( image.domain() );
+  while (state.KeepRunning())
+    {
+      imageFromExpression( result, castValues<unsigned char>( imageExpression( image ) > 128 ) );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_ThresholdExpression)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Masked blend of two images with a loop on the domain points.
+static void BM_BlendPointLoop(benchmark::State& state)
+{
+  const FloatImage a = makeImage<FloatImage>( state, 1 );
+  const FloatImage b = makeImage<FloatImage>( state, 2 );
+  FloatImage result( a.domain() );
+  while (state.KeepRunning())
+    {
+      for(Z3i::Domain::ConstIterator it = a.domain().begin(), itend = a.domain().end(); it != itend; ++it)
+        result.setValue( *it, a( *it ) > 64.0f ? 0.25f * a( *it ) + 0.75f * b( *it ) : 0.0f );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * a.domain().size() );
+}
+BENCHMARK(BM_BlendPointLoop)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Masked blend of two images with an expression.
+static void BM_BlendExpression(benchmark::State& state)
+{
+  const FloatImage a = makeImage<FloatImage>( state, 1 );
+  const FloatImage b = makeImage<FloatImage>( state, 2 );
+  FloatImage result( a.domain() );
+  while (state.KeepRunning())
+    {
+      imageFromExpression( result, select( imageExpression( a ) > 64.0f,
+                                           0.25f * imageExpression( a ) + 0.75f * imageExpression( b ),
+                                           0.0f ) );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * a.domain().size() );
+}
+BENCHMARK(BM_BlendExpression)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Number of points above a threshold, with a loop on the domain points.
+static void BM_CountPointLoop(benchmark::State& state)
+{
+  const Image image = makeImage<Image>( state, 0 );
+  while (state.KeepRunning())
+    {
+      std::size_t count = 0;
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it)
+        count += image( *it ) > 128 ? 1 : 0;
+      benchmark::DoNotOptimize( count );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_CountPointLoop)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Number of points above a threshold, with an expression.
+static void BM_CountExpression(benchmark::State& state)
+{
+  const Image image = makeImage<Image>( state, 0 );
+  while (state.KeepRunning())
+    {
+      const std::size_t count = countValues( imageExpression( image ) > 128 );
+      benchmark::DoNotOptimize( count );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_CountExpression)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkImageResampler.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks of the resampling of images by rigid transformations.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampler.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, unsigned char> Image3;
+typedef functors::BackwardRigidTransformation3D< Z3i::Space > Backward;
+
+/// Image of side state.range(0) filled with pseudo-random values.
+static Image3 makeImage(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0) - 1));
+  Image3 image( dom );
+  srand( 0 );
+  for(Z3i::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it)
+    image.setValue( *it, rand() % 256 );
+  return image;
+}
+
+/// Rotation around the center of the image.
+static Backward makeTransform(benchmark::State& state)
+{
+  const double c = ( state.range(0) - 1 ) / 2.0;
+  return Backward( Z3i::RealPoint( c, c, c ), Z3i::RealVector( 1, 2, -1 ), 0.7, Z3i::RealVector( 0, 0, 0 ) );
+}
+
+/// Resampling through a ConstImageAdapter, one point at a time (out
+/// of domain points are tested by the caller).
+static void BM_AdapterNearest(benchmark::State& state)
+{
+  const Image3 image = makeImage( state );
+  const Backward backward = makeTransform( state );
+  functors::Identity id;
+  ConstImageAdapter<Image3, Z3i::Domain, Backward, unsigned char, functors::Identity>
+    adapter( image, image.domain(), backward, id );
+  while (state.KeepRunning())
+    {
+      Image3 result( image.domain() );
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it)
+        result.setValue( *it, image.domain().isInside( backward( *it ) ) ? adapter( *it ) : 0 );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_AdapterNearest)->RangeMultiplier(2)->Range(1<<5 , 1 << 8);
+
+/// Resampling with ImageResampler.
+static void BM_Resampler(benchmark::State& state)
+{
+  const Image3 image = makeImage( state );
+  const ImageResampler<Z3i::Space> resampler = ImageResampler<Z3i::Space>::fromTransform( makeTransform( state ) );
+  const ImageResampler<Z3i::Space>::Interpolation interpolation =
+    state.range(1) ? ImageResampler<Z3i::Space>::LINEAR : ImageResampler<Z3i::Space>::NEAREST;
+  while (state.KeepRunning())
+    {
+      Image3 result = resampler.resample( image, image.domain(), interpolation );
+      benchmark::DoNotOptimize( result );
+    }
+  state.SetItemsProcessed( state.iterations() * image.domain().size() );
+}
+BENCHMARK(BM_Resampler)->RangeMultiplier(2)->Ranges({{1<<5, 1<<8}, {0, 1}});
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkTiledImage.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Benchmarks of the concurrent reads of a TiledImage, as a function of
+ * the number of threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCache.h"
+#include "DGtal/images/TiledImage.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+typedef ImageFactoryFromImage<VImage> MyImageFactory;
+typedef MyImageFactory::OutputImage OutputImage;
+typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactory> MyReadPolicy;
+typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactory> MyWritePolicy;
+typedef TiledImage<VImage, MyImageFactory, MyReadPolicy, MyWritePolicy> MyTiledImage;
+
+/// 128^3 image cut in 8^3 tiles of 16^3 voxels, all of them in cache.
+struct Fixture
+{
+  Fixture()
+    : image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 127 ) ) ),
+      factory( image ), readPolicy( factory, image.domain().size() * sizeof( int ) ), writePolicy( factory ),
+      tiledImage( factory, readPolicy, writePolicy, 8 )
+  {
+    int i = 0;
+    for ( VImage::Iterator it = image.begin(); it != image.end(); ++it )
+      *it = i++;
+    for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+      benchmark::DoNotOptimize( tiledImage( *it ) );
+  }
+
+  VImage image;
+  MyImageFactory factory;
+  MyReadPolicy readPolicy;
+  MyWritePolicy writePolicy;
+  MyTiledImage tiledImage;
+};
+
+static Fixture & fixture()
+{
+  static Fixture f;
+  return f;
+}
+
+/// Each thread scans the slices state.thread_index() (modulo 128) of
+/// the TiledImage: the reads hit the cache, on different tiles for the
+/// different threads.
+static void BM_TiledImageConcurrentReads(benchmark::State& state)
+{
+  MyTiledImage & tiledImage = fixture().tiledImage;
+  const int z = ( 16 * state.thread_index() ) % 128;
+  long sum = 0;
+  while (state.KeepRunning())
+    {
+      for ( int y = 0; y < 128; y++ )
+        for ( int x = 0; x < 128; x++ )
+          sum += tiledImage( Z3i::Point( x, y, z ) );
+    }
+  benchmark::DoNotOptimize( sum );
+  state.SetItemsProcessed( state.iterations() * 128 * 128 );
+}
+BENCHMARK(BM_TiledImageConcurrentReads)->ThreadRange(1, 8)->UseRealTime();
+
+/// ImageCache holding the 8 slabs of 16 slices of a 128^3 image.
+struct CacheFixture
+{
+  CacheFixture()
+    : image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 127 ) ) ),
+      factory( image ), readPolicy( factory, image.domain().size() * sizeof( int ) ), writePolicy( factory ),
+      cache( factory, readPolicy, writePolicy )
+  {
+    int i = 0;
+    for ( VImage::Iterator it = image.begin(); it != image.end(); ++it )
+      *it = i++;
+    for ( int z = 0; z < 128; z += 16 )
+      cache.update( Z3i::Domain( Z3i::Point( 0, 0, z ), Z3i::Point( 127, 127, z + 15 ) ) );
+  }
+
+  VImage image;
+  MyImageFactory factory;
+  MyReadPolicy readPolicy;
+  MyWritePolicy writePolicy;
+  ImageCache<OutputImage, MyImageFactory, MyReadPolicy, MyWritePolicy> cache;
+};
+
+static CacheFixture & cacheFixture()
+{
+  static CacheFixture f;
+  return f;
+}
+
+/// Same scans through ImageCache::read, which looks up the pages under
+/// the cache mutex.
+static void BM_ImageCacheConcurrentReads(benchmark::State& state)
+{
+  CacheFixture & f = cacheFixture();
+  const int z = ( 16 * state.thread_index() ) % 128;
+  long sum = 0;
+  while (state.KeepRunning())
+    {
+      int value = 0;
+      for ( int y = 0; y < 128; y++ )
+        for ( int x = 0; x < 128; x++ )
+          if ( f.cache.read( Z3i::Point( x, y, z ), value ) )
+            sum += value;
+    }
+  benchmark::DoNotOptimize( sum );
+  state.SetItemsProcessed( state.iterations() * 128 * 128 );
+}
+BENCHMARK(BM_ImageCacheConcurrentReads)->ThreadRange(1, 8)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
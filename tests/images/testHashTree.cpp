@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <algorithm>
+#include <thread>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/io/boards/Board2D.h"
@@ -274,6 +277,104 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Bulk construction and concurrent reads.
+ *
+ */
+bool testBulkLoad()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> ImageVector;
+  typedef std::pair<Image::HashKey, int> KeyValue;
+
+  trace.beginBlock ( "Bulk construction" );
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 37, 34, 20 ) );
+  ImageVector imageV( domain );
+  Image imageSet( domain, 6, 0 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const Z3i::Point p = *it - Z3i::Point( 16, 16, 10 );
+      const int value = ( p.dot( p ) < 100 ) ? 1 : ( ( p[0] > 12 ) ? 2 : 0 );
+      imageV.setValue( *it, value );
+      imageSet.setValue( *it, value );
+    }
+
+  Image imageBulk( domain, 6, 5 );
+  imageBulk.assignFromImage( imageV );
+
+  std::vector<KeyValue> pairs;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( imageV( *it ) != 0 )
+      pairs.push_back( KeyValue( imageBulk.getKey( *it ), imageV( *it ) ) );
+  std::sort( pairs.begin(), pairs.end() );
+  Image imageSorted( domain, 6, 0 );
+  imageSorted.assignFromSortedRange( pairs.begin(), pairs.end() );
+
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    same = same && ( imageBulk( *it ) == imageV( *it ) )
+      && ( imageSorted( *it ) == imageV( *it ) ) && ( imageSet( *it ) == imageV( *it ) );
+  trace.info() << imageSet << imageBulk << imageSorted;
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk constructions == image" << std::endl;
+  nbok += ( imageBulk.getNbNodes() <= imageSet.getNbNodes() ) ? 1 : 0;
+  nb++;
+  nbok += ( imageSorted.getNbNodes() == imageBulk.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk constructions have no more nodes" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Concurrent reads" );
+  std::vector<int> results( 4, 0 );
+  std::vector<std::thread> threads;
+  for ( unsigned int t = 0; t < results.size(); ++t )
+    threads.push_back( std::thread( [&imageBulk, &imageV, &domain, &results, t] {
+          bool ok = true;
+          for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+            ok = ok && ( imageBulk( *it ) == imageV( *it ) )
+              && ( imageBulk.upwardGet( imageBulk.getKey( *it ) ) == imageV( *it ) );
+          results[ t ] = ok ? 1 : 0;
+        } ) );
+  for ( unsigned int t = 0; t < threads.size(); ++t )
+    threads[ t ].join();
+  nbok += ( std::count( results.begin(), results.end(), 1 ) == 4 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "concurrent reads == image" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Sparse volume with keys larger than 32 bits" );
+  const Z3i::Domain bigDomain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 2048, 2047, 2047 ) );
+  Image sparse( bigDomain, 10, 0 );
+  const Z3i::Point points[] = { Z3i::Point( 1, 2, 3 ), Z3i::Point( 1500, 2000, 1999 ),
+                                Z3i::Point( 2048, 1024, 7 ) };
+  pairs.clear();
+  for ( unsigned int i = 0; i < 3; ++i )
+    pairs.push_back( KeyValue( sparse.getKey( points[ i ] ), i + 1 ) );
+  std::sort( pairs.begin(), pairs.end() );
+  sparse.assignFromSortedRange( pairs.begin(), pairs.end() );
+  trace.info() << sparse;
+  nbok += ( sparse.getDepth() == 12 ) ? 1 : 0;
+  nb++;
+  bool found = true;
+  for ( unsigned int i = 0; i < 3; ++i )
+    found = found && ( sparse( points[ i ] ) == int( i + 1 ) )
+      && ( sparse( points[ i ] - Z3i::Point( 0, 0, 1 ) ) == 0 );
+  nbok += found ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sparse values found" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -285,7 +386,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes() && testBulkLoad();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -290,6 +290,101 @@ bool testSimple()
     return nbok == nb;
 }
 
+bool testMemoryBudget()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageCache with a memory budget (LRU and ARC)");
+    
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(3,3)));
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage > MyImageFactoryFromImage;
+    MyImageFactoryFromImage factImage(image);
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    
+    Z2i::Domain domain1(Z2i::Point(0,0), Z2i::Point(1,1));
+    Z2i::Domain domain2(Z2i::Point(2,0), Z2i::Point(3,1));
+    Z2i::Domain domain3(Z2i::Point(0,2), Z2i::Point(1,3));
+    Z2i::Domain domain4(Z2i::Point(2,2), Z2i::Point(3,3));
+    const std::size_t pageBytes = 4*sizeof(int);
+    OutputImage::Value aValue;
+    
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(factImage);
+    
+    // 1) ImageCache with DGtal::CACHE_READ_POLICY_LRU, DGtal::CACHE_WRITE_POLICY_WB: two pages
+    trace.info() << "ImageCache with DGtal::CACHE_READ_POLICY_LRU, DGtal::CACHE_WRITE_POLICY_WB" << endl;
+    
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(factImage, 2*pageBytes);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyImageCacheLRU;
+    MyImageCacheLRU imageCacheLRU(factImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB);
+    
+    imageCacheLRU.update(domain1);
+    imageCacheLRU.update(domain2);
+    nbok += (imageCacheLRU.getCacheEviction() == 0 && imageCacheReadPolicyLRU.bytes() == 2*pageBytes) ? 1 : 0;
+    nb++;
+    
+    aValue = 42;
+    nbok += imageCacheLRU.write(Z2i::Point(0,0), aValue) ? 1 : 0; // domain1 is now the most recently used
+    nb++;
+    
+    imageCacheLRU.update(domain3); // so detach domain2
+    nbok += (imageCacheLRU.getPage(domain2) == NULL && imageCacheLRU.getPage(domain1) != NULL) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheLRU.getCacheEviction() == 1 && imageCacheReadPolicyLRU.bytes() == 2*pageBytes) ? 1 : 0;
+    nb++;
+    nbok += (image(Z2i::Point(0,0)) == 1) ? 1 : 0;
+    nb++;
+    
+    imageCacheLRU.update(domain4); // domain1 was accessed by getPage, so detach (and flush) domain3
+    imageCacheLRU.update(domain2); // so detach (and flush) domain1
+    nbok += (imageCacheLRU.getPage(domain1) == NULL && imageCacheLRU.getCacheEviction() == 3) ? 1 : 0;
+    nb++;
+    nbok += (image(Z2i::Point(0,0)) == 42) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheLRU.read(Z2i::Point(3,3), aValue) && aValue == 16 && imageCacheLRU.getCacheHitRead() == 1) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    // 2) ImageCache with DGtal::CACHE_READ_POLICY_ARC, DGtal::CACHE_WRITE_POLICY_WB: two pages
+    trace.info() << "ImageCache with DGtal::CACHE_READ_POLICY_ARC, DGtal::CACHE_WRITE_POLICY_WB" << endl;
+    
+    typedef ImageCacheReadPolicyARC<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyARC;
+    MyImageCacheReadPolicyARC imageCacheReadPolicyARC(factImage, 2*pageBytes);
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyARC, MyImageCacheWritePolicyWB> MyImageCacheARC;
+    MyImageCacheARC imageCacheARC(factImage, imageCacheReadPolicyARC, imageCacheWritePolicyWB);
+    
+    imageCacheARC.update(domain1);
+    imageCacheARC.update(domain2);
+    nbok += imageCacheARC.read(Z2i::Point(1,1), aValue) ? 1 : 0; // domain1 is accessed again
+    nb++;
+    
+    imageCacheARC.update(domain3); // a scan through domain3 and domain4 keeps domain1
+    imageCacheARC.update(domain4);
+    nbok += (imageCacheARC.getPage(domain1) != NULL && imageCacheARC.getPage(domain2) == NULL) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheARC.getCacheEviction() == 2 && imageCacheReadPolicyARC.bytes() == 2*pageBytes) ? 1 : 0;
+    nb++;
+    
+    imageCacheARC.update(domain3); // domain3 was detached recently: the target of T1 grows
+    nbok += (imageCacheARC.getPage(domain3) != NULL && imageCacheReadPolicyARC.target() == pageBytes) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    trace.endBlock();
+    
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -301,7 +396,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple(); // && ... other tests
+    bool res = testSimple() && testMemoryBudget(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char >  Image;
+typedef ImageContainerByBricks< Z3i::Domain, unsigned char >     BrickImage;
+typedef ImageContainerByBricks< Z2i::Domain, int, 2 >            BrickImage2;
+
+TEST_CASE( "ImageContainerByBricks concepts" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< BrickImage > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< BrickImage2 > ));
+}
+
+TEST_CASE( "ImageContainerByBricks stores the values of any domain" )
+{
+  const Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+  const Z3i::Point shift( -3, 5, 2 );
+  // Not a multiple of the brick size, and elongated.
+  const Z3i::Domain domain( image.domain().lowerBound() + shift,
+                            image.domain().upperBound() + shift - Z3i::Point( 0, 17, 11 ) );
+  BrickImage bricks( domain, 7 );
+  REQUIRE( bricks.isValid() );
+  REQUIRE( bricks( domain.upperBound() ) == 7 );
+
+  for ( const Z3i::Point & p : domain )
+    bricks.setValue( p, image( p - shift ) );
+
+  SECTION( "Values are read back by point" )
+    {
+      bool ok = true;
+      for ( const Z3i::Point & p : domain )
+        ok = ok && ( bricks( p ) == image( p - shift ) );
+      REQUIRE( ok );
+    }
+
+  SECTION( "Ranges follow the domain order" )
+    {
+      Image expected( domain );
+      for ( const Z3i::Point & p : domain )
+        expected.setValue( p, image( p - shift ) );
+      REQUIRE( std::equal( expected.constRange().begin(), expected.constRange().end(),
+                           bricks.constRange().begin() ) );
+
+      BrickImage copy( domain );
+      std::copy( expected.constRange().begin(), expected.constRange().end(),
+                 copy.range().outputIterator() );
+      REQUIRE( std::equal( expected.constRange().begin(), expected.constRange().end(),
+                           copy.constRange().begin() ) );
+    }
+
+  SECTION( "Storage indices are distinct and in brick order" )
+    {
+      std::set< BrickImage::Size > indices;
+      for ( const Z3i::Point & p : domain )
+        indices.insert( bricks.linearized( p ) );
+      REQUIRE( indices.size() == domain.size() );
+      REQUIRE( *indices.rbegin() < bricks.nbBricks() * BrickImage::brickVolume );
+      REQUIRE( bricks.linearized( domain.lowerBound() ) == 0 );
+      REQUIRE( bricks.linearized( domain.lowerBound() + Z3i::Point( 8, 0, 0 ) ) == BrickImage::brickVolume );
+      REQUIRE( bricks.linearized( domain.lowerBound() + Z3i::Point( 0, 8, 0 ) ) == 2 * BrickImage::brickVolume );
+    }
+
+  SECTION( "Bricks cover the domain" )
+    {
+      BrickImage::Size nbPoints = 0;
+      bool ok = true;
+      for ( BrickImage::Size i = 0; i < bricks.nbBricks(); ++i )
+        {
+          const Z3i::Domain brick = bricks.brickDomain( i );
+          ok = ok && domain.isInside( brick.lowerBound() ) && domain.isInside( brick.upperBound() );
+          nbPoints += brick.size();
+          const unsigned char * values = bricks.brickValues( i );
+          for ( const Z3i::Point & p : brick )
+            ok = ok && ( values[ bricks.linearized( p ) - i * BrickImage::brickVolume ] == bricks( p ) );
+        }
+      REQUIRE( ok );
+      REQUIRE( nbPoints == domain.size() );
+    }
+
+  SECTION( "Neighbors inside a brick are at stride offsets" )
+    {
+      unsigned int nbInside = 0;
+      bool ok = true;
+      for ( const Z3i::Point & p : domain )
+        {
+          if ( ! bricks.isInsideBrick( p ) ) continue;
+          ++nbInside;
+          const BrickImage::Size index = bricks.linearized( p );
+          for ( Dimension k = 0; k < 3; ++k )
+            {
+              const Z3i::Point e = Z3i::Point::base( k );
+              ok = ok && ( bricks[ index + BrickImage::stride( k ) ] == bricks( p + e ) )
+                && ( bricks[ index - BrickImage::stride( k ) ] == bricks( p - e ) )
+                && domain.isInside( p + e );
+            }
+        }
+      REQUIRE( ok );
+      REQUIRE( nbInside > 0 );
+      REQUIRE( ! bricks.isInsideBrick( domain.lowerBound() ) );
+      REQUIRE( ! bricks.isInsideBrick( domain.upperBound() - Z3i::Point::diagonal( 1 ), 2 ) );
+    }
+}
+
+TEST_CASE( "ImageContainerByBricks in 2D" )
+{
+  const Z2i::Domain domain( Z2i::Point( -5, -9 ), Z2i::Point( 20, 3 ) );
+  BrickImage2 image( domain );
+  for ( const Z2i::Point & p : domain )
+    image.setValue( p, p[ 0 ] * 100 + p[ 1 ] );
+  bool ok = true;
+  for ( const Z2i::Point & p : domain )
+    ok = ok && ( image( p ) == p[ 0 ] * 100 + p[ 1 ] );
+  REQUIRE( ok );
+  REQUIRE( image.nbBricks() == 7 * 4 );
+  REQUIRE( BrickImage2::stride( 1 ) == 4 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedFile.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageContainerByMappedFile and the
+ * mapping methods of RawReader, VolReader and LongvolReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char >   Image;
+typedef ImageContainerByMappedFile< Z3i::Domain, unsigned char >  MappedImage;
+
+/// @return true if both images have the same domain and values.
+template <typename TImage1, typename TImage2>
+bool sameImages( const TImage1 & image1, const TImage2 & image2 )
+{
+  if ( image1.domain().lowerBound() != image2.domain().lowerBound()
+       || image1.domain().upperBound() != image2.domain().upperBound() )
+    return false;
+  for ( const Z3i::Point & p : image1.domain() )
+    if ( image1( p ) != image2( p ) )
+      return false;
+  return std::equal( image1.constRange().begin(), image1.constRange().end(),
+                     image2.constRange().begin() );
+}
+
+/// @return true if calling @a f throws an exception of type TException.
+template <typename TException, typename TFunction>
+bool throws( TFunction f )
+{
+  try { f(); }
+  catch ( const TException & ) { return true; }
+  return false;
+}
+
+TEST_CASE( "ImageContainerByMappedFile concepts" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MappedImage > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< ImageContainerByMappedFile< Z2i::Domain, uint32_t > > ));
+}
+
+TEST_CASE( "Mapping files gives the same images as reading them" )
+{
+  SECTION( "Raw files" )
+    {
+      typedef ImageContainerBySTLVector< Z3i::Domain, uint32_t > Image32;
+      const Z3i::Vector extent( 5, 5, 5 );
+      const std::string filename = testPath + "samples/raw32bits5x5x5.raw";
+      Image32 image = RawReader< Image32 >::importRaw< uint32_t >( filename, extent );
+      ImageContainerByMappedFile< Z3i::Domain, uint32_t > mapped
+        = RawReader< Image32 >::mapRaw< uint32_t >( filename, extent );
+      REQUIRE( mapped.isValid() );
+      REQUIRE( mapped.isMapped() );
+      REQUIRE( mapped.mode() == MappedImage::READ_ONLY );
+      REQUIRE( sameImages( image, mapped ) );
+    }
+
+  SECTION( "Vol files" )
+    {
+      Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+      VolWriter< Image >::exportVol( "mappedFile-cat10.vol", image, false );
+      MappedImage mapped = VolReader< Image >::mapVol( "mappedFile-cat10.vol" );
+      REQUIRE( mapped.isValid() );
+      REQUIRE( sameImages( image, mapped ) );
+      // Compressed files can't be mapped.
+      REQUIRE( throws<IOException>( [] { VolReader< Image >::mapVol( testPath + "samples/cat10.vol" ); } ) );
+    }
+
+  SECTION( "Longvol files" )
+    {
+      typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::uint64_t > Image64;
+      const std::string filename = testPath + "samples/test.longvol";
+      Image64 image = LongvolReader< Image64 >::importLongvol( filename );
+      typedef LongvolReader< Image64 >::MappedImage MappedImage64;
+      MappedImage64 mapped = LongvolReader< Image64 >::mapLongvol( filename );
+      REQUIRE( mapped.isValid() );
+      // The text header leaves the values unaligned: they are mapped anyway.
+      REQUIRE( mapped.isMapped() );
+      REQUIRE( sameImages( image, mapped ) );
+      REQUIRE( mapped.isMapped() );
+
+      MappedImage64 modified
+        = LongvolReader< Image64 >::mapLongvol( filename, MappedImage64::COPY_ON_WRITE );
+      const Z3i::Point p = image.domain().upperBound();
+      modified.setValue( p, 42 );
+      REQUIRE( modified.isMapped() );
+      REQUIRE( modified( p ) == 42 );
+      *modified.range().begin() = 7;
+      REQUIRE( *modified.constRange().begin() == 7 );
+      REQUIRE( modified( p ) == 42 );
+      REQUIRE( sameImages( image, mapped ) );
+    }
+
+  SECTION( "Missing or too short files" )
+    {
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 99, 99, 99 ) );
+      REQUIRE( throws<IOException>( [&] { MappedImage( "mappedFile-missing.raw", domain ); } ) );
+      REQUIRE( throws<IOException>( [&] { MappedImage( testPath + "samples/raw32bits5x5x5.raw",
+                                                       domain ); } ) );
+    }
+}
+
+TEST_CASE( "Copy-on-write mapping" )
+{
+  Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+  VolWriter< Image >::exportVol( "mappedFile-cow.vol", image, false );
+  const Z3i::Point p( 3, 5, 7 );
+  const unsigned char value = image( p ) + 1;
+  {
+    MappedImage mapped = VolReader< Image >::mapVol( "mappedFile-cow.vol",
+                                                     MappedImage::COPY_ON_WRITE );
+    const MappedImage copy = mapped;
+    mapped.setValue( p, value );
+    *mapped.range().begin() = 7;
+    REQUIRE( mapped( p ) == value );
+    REQUIRE( *mapped.constRange().begin() == 7 );
+    mapped.advise( MappedImage::DONT_NEED );
+    REQUIRE( mapped( p ) == value );
+    // Copies are not affected by the modifications of the original.
+    REQUIRE( copy.isMapped() );
+    REQUIRE( sameImages( image, copy ) );
+    MappedImage copy2 = mapped;
+    copy2.setValue( p, value + 1 );
+    REQUIRE( copy2( p ) == value + 1 );
+    REQUIRE( mapped( p ) == value );
+  }
+  // The file is left untouched.
+  MappedImage mapped = VolReader< Image >::mapVol( "mappedFile-cow.vol" );
+  REQUIRE( sameImages( image, mapped ) );
+  // A READ_ONLY image refuses modifications.
+  REQUIRE( throws<IOException>( [&] { mapped.setValue( p, value ); } ) );
+  REQUIRE( throws<IOException>( [&] { mapped.range(); } ) );
+  REQUIRE( sameImages( image, mapped ) );
+}
+
+TEST_CASE( "Mapped images in algorithms" )
+{
+  typedef functors::SimpleThresholdForegroundPredicate< Image >       Predicate;
+  typedef functors::SimpleThresholdForegroundPredicate< MappedImage > MappedPredicate;
+  typedef DistanceTransformation< Z3i::Space, Predicate, Z3i::L2Metric >       DT;
+  typedef DistanceTransformation< Z3i::Space, MappedPredicate, Z3i::L2Metric > MappedDT;
+
+  Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+  VolWriter< Image >::exportVol( "mappedFile-algo.vol", image, false );
+  MappedImage mapped = VolReader< Image >::mapVol( "mappedFile-algo.vol" );
+
+  SECTION( "SetFromImage" )
+    {
+      mapped.advise( MappedImage::SEQUENTIAL );
+      Z3i::DigitalSet set( image.domain() ), mappedSet( mapped.domain() );
+      SetFromImage< Z3i::DigitalSet >::append< Image >( set, image, 0, 255 );
+      SetFromImage< Z3i::DigitalSet >::append< MappedImage >( mappedSet, mapped, 0, 255 );
+      REQUIRE( set.size() > 0 );
+      REQUIRE( set.size() == mappedSet.size() );
+      bool included = true;
+      for ( const Z3i::Point & p : set )
+        included = included && mappedSet( p );
+      REQUIRE( included );
+    }
+
+  SECTION( "DistanceTransformation" )
+    {
+      mapped.advise( MappedImage::RANDOM, mapped.domain().lowerBound(),
+                     mapped.domain().upperBound() );
+      Predicate predicate( image, 0 );
+      MappedPredicate mappedPredicate( mapped, 0 );
+      DT dt( image.domain(), predicate, Z3i::l2Metric );
+      MappedDT mappedDT( mapped.domain(), mappedPredicate, Z3i::l2Metric );
+      REQUIRE( std::equal( dt.constRange().begin(), dt.constRange().end(),
+                           mappedDT.constRange().begin() ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
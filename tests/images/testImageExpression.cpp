@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageExpression.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing image expressions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageExpression.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing image expressions.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Z3i::Domain, int >   Image;
+typedef ImageContainerBySTLVector< Z3i::Domain, float > FloatImage;
+typedef ImageContainerBySTLVector< Z3i::Domain, bool >  BoolImage;
+typedef ImageContainerBySTLMap< Z3i::Domain, int >      MapImage;
+typedef functors::Thresholder<int, false, false>       Greater;
+typedef ConstImageAdapter< Image, Z3i::Domain, functors::Identity, bool, Greater > ThresholdAdapter;
+
+/// Image filled with pseudo-random values in [0,256).
+template <typename TImage>
+TImage makeImage( const Z3i::Domain & aDomain, unsigned int aSeed )
+{
+  TImage image( aDomain );
+  srand( aSeed );
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(); it != aDomain.end(); ++it )
+    image.setValue( *it, rand() % 256 );
+  return image;
+}
+
+TEST_CASE( "Image expressions are images" )
+{
+  typedef BinaryImageExpression< ImageTerminal<Image>, ImageTerminal<FloatImage>,
+                                 detail::ImageExpressionPlus > Sum;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< Sum > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< ImageTerminal<ThresholdAdapter> > ));
+  REQUIRE( ImageTerminal<Image>::isLinear );
+  REQUIRE( ImageTerminal<ThresholdAdapter>::isLinear );
+  REQUIRE( ! ImageTerminal<MapImage>::isLinear );
+}
+
+TEST_CASE( "Evaluation of image expressions" )
+{
+  const Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 34, 39, 41 ) );
+  const Image a = makeImage<Image>( domain, 1 );
+  const Image b = makeImage<Image>( domain, 2 );
+  const FloatImage c = makeImage<FloatImage>( domain, 3 );
+  const MapImage m = makeImage<MapImage>( domain, 2 );
+  const Greater greater( 128 );
+  functors::Identity id;
+  const ThresholdAdapter threshold( a, domain, id, greater );
+
+  SECTION( "Arithmetic with scalars" )
+    {
+      const Image result = evaluate( 2 * imageExpression( a ) - imageExpression( b ) / 3 + 7 );
+      const Image sequential = evaluate( 2 * imageExpression( a ) - imageExpression( b ) / 3 + 7, false );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          const int expected = 2 * a( *it ) - b( *it ) / 3 + 7;
+          if ( result( *it ) != expected || sequential( *it ) != expected ) ++nb;
+        }
+      REQUIRE( result.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( nb == 0 );
+    }
+
+  SECTION( "Masks, casts and adapters" )
+    {
+      FloatImage result( domain );
+      imageFromExpression( result, select( imageExpression( threshold ),
+                                           0.5f * ( castValues<float>( imageExpression( a ) ) + imageExpression( c ) ),
+                                           -1.0f ) );
+      const BoolImage mask = evaluate( imageExpression( a ) > 10 && ! ( imageExpression( b ) >= 200 ) );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          const float expected = ( a( *it ) > 128 ) ? 0.5f * ( a( *it ) + c( *it ) ) : -1.0f;
+          if ( result( *it ) != expected ) ++nb;
+          if ( mask( *it ) != ( a( *it ) > 10 && b( *it ) < 200 ) ) ++nb;
+        }
+      REQUIRE( nb == 0 );
+    }
+
+  SECTION( "Point by point evaluation" )
+    {
+      // Sub-domain, and image without linear access.
+      const Z3i::Domain subDomain( Z3i::Point( 0, 3, 4 ), Z3i::Point( 20, 21, 22 ) );
+      Image result( subDomain );
+      imageFromExpression( result, imageExpression( a ) - imageExpression( m ) );
+      Image resultMap( subDomain );
+      imageFromExpression( resultMap, imageExpression( m ) + mapValues( imageExpression( b ), functors::Abs<int>() ) );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = subDomain.begin(); it != subDomain.end(); ++it )
+        {
+          if ( result( *it ) != a( *it ) - b( *it ) ) ++nb;
+          if ( resultMap( *it ) != 2 * b( *it ) ) ++nb;
+        }
+      REQUIRE( nb == 0 );
+    }
+
+  SECTION( "Reductions" )
+    {
+      DGtal::int64_t sum = 0;
+      int minimum = 256, maximum = -1;
+      std::size_t count = 0;
+      double floatSum = 0.0;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          sum += a( *it ) - b( *it );
+          minimum = std::min( minimum, a( *it ) + b( *it ) );
+          maximum = std::max( maximum, a( *it ) );
+          count += ( a( *it ) > 128 ) ? 1 : 0;
+          floatSum += c( *it );
+        }
+      REQUIRE( sumValues( imageExpression( a ) - imageExpression( b ) ) == sum );
+      REQUIRE( sumValues( imageExpression( a ) - imageExpression( m ) ) == sum );
+      REQUIRE( minValue( imageExpression( a ) + imageExpression( b ) ) == minimum );
+      REQUIRE( maxValue( imageExpression( a ), false ) == maximum );
+      REQUIRE( countValues( imageExpression( threshold ) ) == count );
+      REQUIRE( countValues( imageExpression( a ) > 128 ) == count );
+      REQUIRE( std::abs( sumValues( imageExpression( c ) ) - floatSum ) < 1e-3 * floatSum );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageResampler.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ImageResampler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageResampler.h"
+#include "DGtal/images/RigidTransformation2D.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageResampler.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Z2i::Domain, unsigned char > Image2;
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image3;
+typedef ImageContainerBySTLVector< Z3i::Domain, double >        RealImage3;
+
+/// Counts the points whose value differs from the backward
+/// transformation of the source image (or from the outside value).
+template <typename TImage, typename TBackward>
+unsigned int nbDifferences( const TImage & aSource, const TImage & aResult,
+                            const TBackward & aBackward, typename TImage::Value anOutside )
+{
+  unsigned int nb = 0;
+  for ( typename TImage::Domain::ConstIterator it = aResult.domain().begin();
+        it != aResult.domain().end(); ++it )
+    {
+      const typename TImage::Point q = aBackward( *it );
+      const typename TImage::Value expected =
+        aSource.domain().isInside( q ) ? aSource( q ) : anOutside;
+      if ( aResult( *it ) != expected ) ++nb;
+    }
+  return nb;
+}
+
+TEST_CASE( "ImageResampler with nearest neighbor interpolation" )
+{
+  SECTION( "2D rigid transformation" )
+    {
+      typedef functors::ForwardRigidTransformation2D<Z2i::Space> Forward;
+      typedef functors::BackwardRigidTransformation2D<Z2i::Space> Backward;
+      const Image2 image = PGMReader<Image2>::importPGM( testPath + "samples/church-small.pgm" );
+      const Forward forward( Z2i::RealPoint( 5, 5 ), M_PI_4, Z2i::RealVector( 3, -3 ) );
+      const Backward backward( Z2i::RealPoint( 5, 5 ), M_PI_4, Z2i::RealVector( 3, -3 ) );
+      const functors::DomainRigidTransformation2D<Z2i::Domain, Forward> domainTransform( forward );
+      const functors::DomainRigidTransformation2D<Z2i::Domain, Forward>::Bounds bounds =
+        domainTransform( image.domain() );
+      const Z2i::Domain domain( bounds.first, bounds.second );
+
+      const ImageResampler<Z2i::Space> resampler = ImageResampler<Z2i::Space>::fromTransform( backward );
+      const Image2 result = resampler.resample( image, domain, ImageResampler<Z2i::Space>::NEAREST, 7 );
+      REQUIRE( result.domain().lowerBound() == domain.lowerBound() );
+      REQUIRE( result.domain().upperBound() == domain.upperBound() );
+      REQUIRE( nbDifferences( image, result, backward, (unsigned char) 7 ) == 0 );
+    }
+
+  SECTION( "3D rigid transformation" )
+    {
+      typedef functors::ForwardRigidTransformation3D<Z3i::Space> Forward;
+      typedef functors::BackwardRigidTransformation3D<Z3i::Space> Backward;
+      const Image3 image = VolReader<Image3>::importVol( testPath + "samples/cat10.vol" );
+      const Z3i::RealPoint center( 20, 15, 10 );
+      const Z3i::RealVector axis( 1, 2, -1 );
+      const Forward forward( center, axis, 0.7, Z3i::RealVector( 2.5, -1, 4 ) );
+      const Backward backward( center, axis, 0.7, Z3i::RealVector( 2.5, -1, 4 ) );
+      const functors::DomainRigidTransformation3D<Z3i::Domain, Forward> domainTransform( forward );
+      const functors::DomainRigidTransformation3D<Z3i::Domain, Forward>::Bounds bounds =
+        domainTransform( image.domain() );
+      const Z3i::Domain domain( bounds.first, bounds.second );
+
+      const ImageResampler<Z3i::Space> resampler = ImageResampler<Z3i::Space>::fromTransform( backward );
+      const Image3 result = resampler.resample( image, domain );
+      REQUIRE( nbDifferences( image, result, backward, (unsigned char) 0 ) == 0 );
+    }
+
+  SECTION( "Binary images (std::vector<bool> storage)" )
+    {
+      typedef ImageContainerBySTLVector< Z2i::Domain, bool > BinaryImage2;
+      typedef functors::BackwardRigidTransformation2D<Z2i::Space> Backward;
+      BinaryImage2 image( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 36, 28 ) ) );
+      for ( Z2i::Domain::ConstIterator it = image.domain().begin(); it != image.domain().end(); ++it )
+        image.setValue( *it, ( (*it)[ 0 ] * 7 + (*it)[ 1 ] * 3 ) % 5 < 2 );
+      const Backward backward( Z2i::RealPoint( 18, 14 ), 0.4, Z2i::RealVector( 1, -2 ) );
+
+      const ImageResampler<Z2i::Space> resampler = ImageResampler<Z2i::Space>::fromTransform( backward );
+      const BinaryImage2 result = resampler.resample( image, image.domain(), ImageResampler<Z2i::Space>::NEAREST, true );
+      REQUIRE( nbDifferences( image, result, backward, true ) == 0 );
+    }
+
+  SECTION( "Affine transformation" )
+    {
+      const Image3 image = VolReader<Image3>::importVol( testPath + "samples/cat10.vol" );
+      // p -> (2 p[0], p[1] + p[2], p[2] - 3)
+      std::array<Z3i::RealVector, 3> columns = {{ Z3i::RealVector( 2, 0, 0 ),
+                                                  Z3i::RealVector( 0, 1, 0 ),
+                                                  Z3i::RealVector( 0, 1, 1 ) }};
+      const ImageResampler<Z3i::Space> resampler( columns, Z3i::RealPoint( 0, 0, -3 ) );
+      const Image3 result = resampler.resample( image, image.domain(), ImageResampler<Z3i::Space>::NEAREST, 1 );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = image.domain().begin(); it != image.domain().end(); ++it )
+        {
+          const Z3i::Point q( 2 * (*it)[ 0 ], (*it)[ 1 ] + (*it)[ 2 ], (*it)[ 2 ] - 3 );
+          if ( result( *it ) != ( image.domain().isInside( q ) ? image( q ) : 1 ) ) ++nb;
+        }
+      REQUIRE( nb == 0 );
+    }
+}
+
+TEST_CASE( "ImageResampler with linear interpolation" )
+{
+  SECTION( "Integer translations preserve the values" )
+    {
+      const Image3 image = VolReader<Image3>::importVol( testPath + "samples/cat10.vol" );
+      std::array<Z3i::RealVector, 3> columns = {{ Z3i::RealVector( 1, 0, 0 ),
+                                                  Z3i::RealVector( 0, 1, 0 ),
+                                                  Z3i::RealVector( 0, 0, 1 ) }};
+      const ImageResampler<Z3i::Space> resampler( columns, Z3i::RealPoint( 3, -2, 1 ) );
+      const Image3 result = resampler.resample( image, image.domain(), ImageResampler<Z3i::Space>::LINEAR );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = image.domain().begin(); it != image.domain().end(); ++it )
+        {
+          const Z3i::Point q = *it + Z3i::Point( 3, -2, 1 );
+          if ( result( *it ) != ( image.domain().isInside( q ) ? image( q ) : 0 ) ) ++nb;
+        }
+      REQUIRE( nb == 0 );
+    }
+
+  SECTION( "Affine functions are interpolated exactly" )
+    {
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 31, 31 ) );
+      RealImage3 ramp( domain );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        ramp.setValue( *it, 2.0 * (*it)[ 0 ] - (*it)[ 1 ] + 0.5 * (*it)[ 2 ] );
+
+      const functors::BackwardRigidTransformation3D<Z3i::Space>
+        backward( Z3i::RealPoint( 16, 16, 16 ), Z3i::RealVector( 0, 1, 1 ), 0.3, Z3i::RealVector( 0, 0, 0 ) );
+      const ImageResampler<Z3i::Space> resampler = ImageResampler<Z3i::Space>::fromTransform( backward );
+      const RealImage3 result = resampler.resample( ramp, domain, ImageResampler<Z3i::Space>::LINEAR, -1.0 );
+      unsigned int nbInside = 0;
+      double error = 0.0;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          const Z3i::RealPoint x = resampler( *it );
+          if ( x.inf( Z3i::RealPoint( 0, 0, 0 ) ) != Z3i::RealPoint( 0, 0, 0 )
+               || x.sup( Z3i::RealPoint( 31, 31, 31 ) ) != Z3i::RealPoint( 31, 31, 31 ) )
+            continue;
+          ++nbInside;
+          error = std::max( error, std::abs( result( *it ) - ( 2.0 * x[ 0 ] - x[ 1 ] + 0.5 * x[ 2 ] ) ) );
+        }
+      REQUIRE( nbInside > domain.size() / 2 );
+      REQUIRE( error < 1e-9 );
+      REQUIRE( result( Z3i::Point( 0, 31, 0 ) ) == -1.0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -28,12 +28,18 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageFactoryWithPrefetch.h"
 #include "DGtal/images/TiledImage.h"
 
 #include "ConfigTest.h"
@@ -327,6 +333,469 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+bool testTrailingTiles(int aWidth, int aHeight, int N)
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImage with trailing tiles");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(1,1), Z2i::Point(aWidth,aHeight)));
+
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryFromImage, 2);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWT> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWT, N);
+
+    trace.info() << "domain " << tiledImage.domain() << ", block coords " << tiledImage.domainBlockCoords() << endl;
+
+    // every point lies in a tile of domainBlockCoords()
+    bool inside = true;
+    for (Z2i::Domain::ConstIterator it = image.domain().begin(); it != image.domain().end(); ++it)
+      inside = inside && tiledImage.domainBlockCoords().isInside(tiledImage.findBlockCoordsFromPoint(*it));
+    nbok += inside ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "block coords of all the points" << endl;
+
+    bool sameValues = true;
+    for (Z2i::Domain::ConstIterator it = image.domain().begin(); it != image.domain().end(); ++it)
+      sameValues = sameValues && (tiledImage(*it) == image(*it));
+    nbok += sameValues ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "reads" << endl;
+
+    // the range visits each point once
+    long sum = 0;
+    long count = 0;
+    MyTiledImage::ConstRange r = tiledImage.constRange();
+    for (MyTiledImage::ConstRange::ConstIterator it = r.begin(); it != r.end(); ++it, ++count)
+      sum += *it;
+    const long size = image.domain().size();
+    nbok += (count == size && sum == size*(size+1)/2) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "range: " << count << " values" << endl;
+
+    tiledImage.setValue(Z2i::Point(aWidth,aHeight), -1);
+    nbok += (tiledImage(Z2i::Point(aWidth,aHeight)) == -1 && image(Z2i::Point(aWidth,aHeight)) == -1) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "write in the last tile" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testConcurrentReads()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing concurrent reads on a TiledImage with a memory budget");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(63,63)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // 8x8 tiles of 64 int, at most 4 tiles in memory.
+    const std::size_t tileBytes = 64*sizeof(int);
+    typedef ImageCacheReadPolicyARC<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyARC;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyARC imageCacheReadPolicyARC(imageFactoryFromImage, 4*tileBytes);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyARC, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyARC, imageCacheWritePolicyWB, 8);
+
+    const std::ptrdiff_t nbRows = 64;
+    std::vector<long> sums(nbRows, 0);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::ptrdiff_t y = 0; y < nbRows; ++y)
+      for (int x = 0; x < 64; ++x)
+        sums[y] += tiledImage(Z2i::Point(x, static_cast<int>(y)));
+
+    bool sameSums = true;
+    for (std::ptrdiff_t y = 0; y < nbRows; ++y)
+      sameSums = sameSums && (sums[y] == 64*64*y + 63*32);
+    nbok += sameSums ? 1 : 0;
+    nb++;
+    trace.info() << "hits=" << tiledImage.getCacheHitRead() << " misses=" << tiledImage.getCacheMissRead()
+                 << " evictions=" << tiledImage.getCacheEviction() << " bytes=" << imageCacheReadPolicyARC.bytes() << endl;
+    nbok += (tiledImage.getCacheHitRead() + tiledImage.getCacheMissRead() == 64*64) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheReadPolicyARC.bytes() <= 4*tileBytes
+             && tiledImage.getCacheEviction() == tiledImage.getCacheMissRead() - imageCacheReadPolicyARC.bytes()/tileBytes) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testConcurrentReadsAndWrites()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing threads reading and writing a TiledImage with a small cache");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(63,63)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // 8x8 tiles, at most 3 tiles in cache: the threads keep detaching the tiles of the others.
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 3*64*sizeof(int));
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWT> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWT, 8);
+
+    // 4 readers on the rows 0 to 31, 1 writer on the rows 32 to 63.
+    const unsigned int nbReaders = 4;
+    const int nbPasses = 8;
+    std::vector<long> sums(nbReaders, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < nbReaders; t++)
+      threads.push_back(std::thread([&tiledImage, &sums, t, nbPasses] () {
+        for (int pass = 0; pass < nbPasses; pass++)
+          for (int y = 0; y < 32; y++)
+            for (int x = 0; x < 64; x++)
+              sums[t] += tiledImage(Z2i::Point((x + 8*t) % 64, y));
+      }));
+    threads.push_back(std::thread([&tiledImage] () {
+      for (int y = 32; y < 64; y++)
+        for (int x = 0; x < 64; x++)
+          tiledImage.setValue(Z2i::Point(x, y), -1);
+    }));
+    for (unsigned int t = 0; t < threads.size(); t++)
+      threads[t].join();
+
+    bool sameSums = true;
+    for (unsigned int t = 0; t < nbReaders; t++)
+      sameSums = sameSums && (sums[t] == nbPasses * (2048L*2047L/2));
+    nbok += sameSums ? 1 : 0;
+    nb++;
+
+    bool written = true;
+    for (int y = 32; y < 64; y++)
+      for (int x = 0; x < 64; x++)
+        written = written && (image(Z2i::Point(x, y)) == -1) && (tiledImage(Z2i::Point(x, y)) == -1);
+    nbok += written ? 1 : 0;
+    nb++;
+
+    trace.info() << "hits=" << tiledImage.getCacheHitRead() << " misses=" << tiledImage.getCacheMissRead()
+                 << " evictions=" << tiledImage.getCacheEviction() << endl;
+    nbok += (tiledImage.getCacheHitRead() + tiledImage.getCacheMissRead() == nbReaders*nbPasses*32*64 + 32*64) ? 1 : 0;
+    nb++;
+    nbok += (imageCacheReadPolicyLRU.bytes() <= 3*64*sizeof(int)) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testCopiesSharingPolicy()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing copies of a TiledImage sharing a read policy");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(15,15)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // One tile in cache: each copy detaches the tile read by the other one.
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryFromImage, 1);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWB, 4);
+    MyTiledImage copy(tiledImage);
+
+    nbok += (tiledImage(Z2i::Point(0,0)) == 0) ? 1 : 0;
+    nb++;
+    nbok += (copy(Z2i::Point(12,12)) == 12*16+12) ? 1 : 0;
+    nb++;
+    nbok += (tiledImage(Z2i::Point(1,0)) == 1) ? 1 : 0;
+    nb++;
+
+    // Writes through one copy are seen by the other one.
+    copy.setValue(Z2i::Point(2,0), -1);
+    nbok += (tiledImage(Z2i::Point(2,0)) == -1 && copy(Z2i::Point(13,12)) == 12*16+13
+             && image(Z2i::Point(2,0)) == -1) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testPinnedTiles()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing tiled iterators on tiles evicted by other accesses");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(63,63)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // 8x8 tiles, at most 2 tiles in cache.
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 2*64*sizeof(int));
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 8);
+
+    {
+      // The first tile is evicted while the iterator is on it, then written through the iterator.
+      MyTiledImage::OutputIterator it = tiledImage.outputIterator();
+      for (int y = 8; y < 64; y += 8)
+        tiledImage(Z2i::Point(0, y));
+      nbok += (tiledImage.getCacheEviction() > 0 && *it == 0) ? 1 : 0;
+      nb++;
+      for (int j = 0; j < 64; j++, ++it)
+        *it = -1;
+      nbok += (image(Z2i::Point(0, 0)) == -1 && image(Z2i::Point(7, 7)) == -1) ? 1 : 0;
+      nb++;
+    }
+
+    // 4 threads scan the whole image with tiled iterators and keep evicting the tiles of the others.
+    const unsigned int nbThreads = 4;
+    std::vector<long> sums(nbThreads, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < nbThreads; t++)
+      threads.push_back(std::thread([&tiledImage, &sums, t] () {
+        for (int pass = 0; pass < 8; pass++)
+          for (MyTiledImage::ConstIterator it = tiledImage.begin(), itEnd = tiledImage.end(); it != itEnd; ++it)
+            sums[t] += *it;
+      }));
+    for (unsigned int t = 0; t < threads.size(); t++)
+      threads[t].join();
+
+    long sum = 0;
+    for (VImage::ConstIterator it = image.begin(); it != image.end(); ++it)
+        sum += *it;
+    bool sameSums = true;
+    for (unsigned int t = 0; t < nbThreads; t++)
+      sameSums = sameSums && (sums[t] == 8*sum);
+    nbok += sameSums ? 1 : 0;
+    nb++;
+    trace.info() << "hits=" << tiledImage.getCacheHitRead() << " misses=" << tiledImage.getCacheMissRead()
+                 << " evictions=" << tiledImage.getCacheEviction() << endl;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testPrefetch()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImage scans with tile prefetching");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(1,1), Z2i::Point(32,32)));
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = 1;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    typedef ImageFactoryWithPrefetch<MyImageFactoryFromImage> MyImageFactoryWithPrefetch;
+    typedef MyImageFactoryWithPrefetch::OutputImage OutputImage;
+    MyImageFactoryWithPrefetch imageFactoryWithPrefetch(imageFactoryFromImage, 4, 2);
+
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryWithPrefetch> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryWithPrefetch> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryWithPrefetch, 2);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryWithPrefetch);
+
+    typedef TiledImage<VImage, MyImageFactoryWithPrefetch, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryWithPrefetch, imageCacheReadPolicyFIFO, imageCacheWritePolicyWB, 4);
+    tiledImage.setPrefetcher(imageFactoryWithPrefetch, 2);
+
+    // writing values, the tiles are flushed while the next ones are prefetched
+    int i = 0;
+    for (MyTiledImage::Range::OutputIterator it = tiledImage.range().outputIterator(); it != tiledImage.range().end(); ++it)
+      *it = i++;
+    nbok += (imageFactoryWithPrefetch.nbPrefetchHits() + imageFactoryWithPrefetch.nbPrefetchWaits()
+             + imageFactoryWithPrefetch.nbPrefetchMisses() == 16) ? 1 : 0;
+    nb++;
+
+    // reading values, prefetched tiles are up to date
+    std::vector<int> values;
+    MyTiledImage::ConstRange r = tiledImage.constRange();
+    std::copy(r.begin(), r.end(), std::back_inserter(values));
+    bool sameValues = (values.size() == 32*32);
+    for (unsigned int j = 0; j < values.size(); j++)
+      sameValues = sameValues && (values[j] == static_cast<int>(j));
+    nbok += sameValues ? 1 : 0;
+    nb++;
+
+    trace.info() << imageFactoryWithPrefetch << endl;
+    nbok += (imageFactoryWithPrefetch.nbPrefetchMisses() >= 1 && imageFactoryWithPrefetch.nbPrefetchDropped() == 0
+             && imageFactoryWithPrefetch.stallTime() >= 0.0) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Image factory whose first request blocks until open() is called.
+ */
+template <typename TImageContainer>
+struct GatedImageFactory : public ImageFactoryFromImage<TImageContainer>
+{
+    typedef ImageFactoryFromImage<TImageContainer> Base;
+    typedef typename Base::Domain Domain;
+    typedef typename Base::OutputImage OutputImage;
+
+    GatedImageFactory(TImageContainer & anImage)
+      : Base(anImage), myEntered(false), myOpen(false)
+    {}
+
+    OutputImage * requestImage(const Domain & aDomain)
+    {
+        {
+            std::unique_lock<std::mutex> lock(myMutex);
+            if (!myEntered)
+            {
+                myEntered = true;
+                myCondition.notify_all();
+                myCondition.wait(lock, [this] { return myOpen; });
+            }
+        }
+        return Base::requestImage(aDomain);
+    }
+
+    void waitEntered()
+    {
+        std::unique_lock<std::mutex> lock(myMutex);
+        myCondition.wait(lock, [this] { return myEntered; });
+    }
+
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(myMutex);
+        myOpen = true;
+        myCondition.notify_all();
+    }
+
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    bool myEntered;
+    bool myOpen;
+};
+
+bool testPrefetchFlushDuringRequest()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing a flush while a prefetched image is requested");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(1,1), Z2i::Point(8,8)));
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = 1;
+
+    typedef GatedImageFactory<VImage> MyGatedImageFactory;
+    MyGatedImageFactory gatedImageFactory(image);
+    typedef ImageFactoryWithPrefetch<MyGatedImageFactory> MyImageFactoryWithPrefetch;
+    typedef MyImageFactoryWithPrefetch::OutputImage OutputImage;
+    MyImageFactoryWithPrefetch imageFactoryWithPrefetch(gatedImageFactory, 4, 1, true);
+
+    // the worker loads the old values of the tile, and blocks
+    const Z2i::Domain tile(Z2i::Point(1,1), Z2i::Point(4,4));
+    imageFactoryWithPrefetch.prefetch(tile);
+    gatedImageFactory.waitEntered();
+
+    // another thread requests the tile and waits for the worker
+    OutputImage * requested = NULL;
+    std::thread requester([&imageFactoryWithPrefetch, &requested, &tile] () {
+        requested = imageFactoryWithPrefetch.requestImage(tile);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // the tile is written back while it is loading: the prefetched image is outdated
+    OutputImage written(tile);
+    for (OutputImage::Iterator it = written.begin(); it != written.end(); ++it)
+        *it = 7;
+    imageFactoryWithPrefetch.flushImage(&written);
+
+    gatedImageFactory.open();
+    requester.join();
+
+    bool upToDate = (requested != NULL);
+    for (Z2i::Domain::ConstIterator it = tile.begin(); upToDate && it != tile.end(); ++it)
+        upToDate = ((*requested)(*it) == 7);
+    nbok += upToDate ? 1 : 0;
+    nb++;
+    trace.info() << imageFactoryWithPrefetch << endl;
+    nbok += (imageFactoryWithPrefetch.nbPrefetchWaits() + imageFactoryWithPrefetch.nbPrefetchMisses() == 1
+             && imageFactoryWithPrefetch.nbPrefetchHits() == 0) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    if (requested)
+        imageFactoryWithPrefetch.detachImage(requested);
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -338,7 +807,8 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange()
+      && testTrailingTiles(11, 9, 4) && testTrailingTiles(9, 9, 6) && testConcurrentReads() && testConcurrentReadsAndWrites() && testCopiesSharingPolicy() && testPinnedTiles() && testPrefetch() && testPrefetchFlushDuringRequest(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
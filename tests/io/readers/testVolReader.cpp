@@ -29,10 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
 #include "DGtal/io/colormaps/GrayscaleColorMap.h"
@@ -166,6 +169,97 @@ bool testConsistence()
   return true;
 }
 
+/// A functor that is not a plain cast.
+struct ShiftFunctor
+{
+  int operator()( unsigned char v ) const { return 3 * int( v ) - 7; }
+};
+
+bool testBulkRead()
+{
+  trace.beginBlock ( "Testing VolReader on contiguous and generic images ..." );
+
+  typedef SpaceND<3> Space;
+  typedef HyperRectDomain<Space> TDomain;
+  typedef TDomain::Point Point;
+  typedef ImageContainerBySTLVector<TDomain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<TDomain, int> IntImage;
+  typedef ImageContainerBySTLMap<TDomain, int> MapImage;
+  typedef ImageContainerBySTLVector<TDomain, bool> BoolImage;
+
+  TDomain domain( Point( -5, -3, 2 ), Point( 40, 30, 20 ) );
+  Image image( domain );
+  for ( const Point & p : domain )
+    image.setValue( p, (unsigned char)( ( p[ 0 ] * 7 + p[ 1 ] * 13 + p[ 2 ] * p[ 0 ] ) & 0xff ) );
+
+  bool ok = true;
+  for ( bool compressed : { false, true } )
+    {
+      VolWriter<Image>::exportVol( "testBulkRead.vol", image, compressed );
+      Image image2 = VolReader<Image>::importVol( "testBulkRead.vol" );
+      IntImage image3 = VolReader<IntImage, ShiftFunctor>::importVol( "testBulkRead.vol", ShiftFunctor() );
+      MapImage image4 = VolReader<MapImage, ShiftFunctor>::importVol( "testBulkRead.vol", ShiftFunctor() );
+      BoolImage image5 = VolReader<BoolImage>::importVol( "testBulkRead.vol" );
+      ok = ok && image2.domain().lowerBound() == domain.lowerBound()
+        && image2.domain().upperBound() == domain.upperBound();
+      for ( const Point & p : domain )
+        ok = ok && image2( p ) == image( p )
+          && image3( p ) == ShiftFunctor()( image( p ) )
+          && image4( p ) == image3( p )
+          && image5( p ) == ( image( p ) != 0 );
+      trace.info() << "compressed=" << compressed << " ok=" << ok << std::endl;
+    }
+  trace.endBlock();
+  return ok;
+}
+
+bool testBlockRead()
+{
+  trace.beginBlock ( "Testing VolReader on files larger than its read blocks ..." );
+
+  typedef SpaceND<3> Space;
+  typedef HyperRectDomain<Space> TDomain;
+  typedef TDomain::Point Point;
+  typedef ImageContainerBySTLVector<TDomain, unsigned char> Image;
+
+  // 1.3M voxels: several read blocks, for raw and compressed data.
+  TDomain domain( Point( 0, 0, 0 ), Point( 127, 127, 79 ) );
+  Image image( domain );
+  for ( const Point & p : domain )
+    image.setValue( p, (unsigned char)( ( p[ 0 ] * p[ 1 ] + p[ 2 ] * 3 ) & 0xff ) );
+
+  bool ok = true;
+  for ( bool compressed : { false, true } )
+    {
+      VolWriter<Image>::exportVol( "testBlockRead.vol", image, compressed );
+      Image image2 = VolReader<Image>::importVol( "testBlockRead.vol" );
+      for ( const Point & p : domain )
+        ok = ok && image2( p ) == image( p );
+
+      // A truncated file is reported as such.
+      std::ifstream in( "testBlockRead.vol", std::ios::binary );
+      std::string bytes( ( std::istreambuf_iterator<char>( in ) ),
+                         std::istreambuf_iterator<char>() );
+      in.close();
+      std::ofstream out( "testBlockRead.vol", std::ios::binary | std::ios::trunc );
+      out.write( bytes.data(), bytes.size() / 2 );
+      out.close();
+      bool caught = false;
+      try
+        {
+          Image image3 = VolReader<Image>::importVol( "testBlockRead.vol" );
+        }
+      catch ( const IOException & )
+        {
+          caught = true;
+        }
+      ok = ok && caught;
+      trace.info() << "compressed=" << compressed << " ok=" << ok << std::endl;
+    }
+  trace.endBlock();
+  return ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -180,7 +274,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence()
+    && testBulkRead() && testBlockRead(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBrickVol.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing the BrickVol format: BrickVolFile,
+ * BrickVolReader, BrickVolWriter and ImageFactoryFromBrickVol.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageFactoryFromBrickVol.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/images/ImageCache.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/BrickVolReader.h"
+#include "DGtal/io/writers/BrickVolWriter.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the BrickVol format.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+typedef ImageContainerBySTLMap< Z3i::Domain, int >              MapImage;
+typedef ImageFactoryFromBrickVol< Image >                       Factory;
+
+/// @return true if @a image2 has the values of @a image1 on the domain of @a image2.
+template <typename TImage1, typename TImage2>
+bool sameValues( const TImage1 & image1, const TImage2 & image2 )
+{
+  for ( const Z3i::Point & p : image2.domain() )
+    if ( static_cast<int>( image1( p ) ) != static_cast<int>( image2( p ) ) )
+      return false;
+  return true;
+}
+
+/// @return true if calling @a f throws an exception of type TException.
+template <typename TException, typename TFunction>
+bool throws( TFunction f )
+{
+  try { f(); }
+  catch ( const TException & ) { return true; }
+  return false;
+}
+
+TEST_CASE( "BrickVol export and import" )
+{
+  const Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+
+  SECTION( "Bricks are written and read back, whatever the codec and brick size" )
+    {
+      for ( BrickVolFile::Codec codec : { BrickVolFile::NONE, BrickVolFile::ZLIB } )
+        {
+          for ( unsigned int brick : { 7, 16, 64 } )
+            {
+              REQUIRE( BrickVolWriter< Image >::exportBrickVol( "brickvol-cat10.bvol", image,
+                                                                brick, codec ) );
+              const Image read = BrickVolReader< Image >::importBrickVol( "brickvol-cat10.bvol" );
+              REQUIRE( read.domain().lowerBound() == image.domain().lowerBound() );
+              REQUIRE( read.domain().upperBound() == image.domain().upperBound() );
+              REQUIRE( sameValues( image, read ) );
+            }
+        }
+    }
+
+  SECTION( "Any image container can be filled" )
+    {
+      BrickVolWriter< Image >::exportBrickVol( "brickvol-cat10.bvol", image, 16 );
+      const MapImage read = BrickVolReader< MapImage >::importBrickVol( "brickvol-cat10.bvol" );
+      REQUIRE( sameValues( image, read ) );
+    }
+
+  SECTION( "Binary images are written and read back" )
+    {
+      typedef ImageContainerBySTLVector< Z3i::Domain, bool > BoolImage;
+      BoolImage binary( image.domain() );
+      for ( const Z3i::Point & p : image.domain() )
+        binary.setValue( p, image( p ) > 0 );
+      typedef BrickVolWriter< BoolImage, functors::Cast< unsigned char > > BoolWriter;
+      REQUIRE( BoolWriter::exportBrickVol( "brickvol-cat10-bool.bvol", binary, 7 ) );
+      const BoolImage read = BrickVolReader< BoolImage >::importBrickVol( "brickvol-cat10-bool.bvol" );
+      REQUIRE( sameValues( binary, read ) );
+    }
+
+  SECTION( "The header describes the bricks" )
+    {
+      BrickVolWriter< Image >::exportBrickVol( "brickvol-cat10.bvol", image, 16 );
+      BrickVolFile file;
+      file.open( "brickvol-cat10.bvol" );
+      REQUIRE( file.isValid() );
+      REQUIRE( file.nbBricks() == 27 );
+      REQUIRE( file.codec() == BrickVolFile::ZLIB );
+      BrickVolFile::Coordinates lower, upper;
+      file.brickBounds( 26, lower, upper );
+      REQUIRE( upper == file.upperBound() );
+      const BrickVolFile::Integer width = upper[ 0 ] - lower[ 0 ] + 1;
+      REQUIRE( width == 40 - 32 );
+      REQUIRE( file.bricks( file.lowerBound(), file.lowerBound() ).size() == 1 );
+    }
+
+  SECTION( "Invalid files are rejected" )
+    {
+      BrickVolFile file;
+      REQUIRE( throws<IOException>( [&] { file.open( testPath + "samples/cat10.vol" ); } ) );
+      REQUIRE( throws<IOException>( [&] { file.open( "brickvol-missing.bvol" ); } ) );
+    }
+}
+
+TEST_CASE( "Rewriting bricks reuses the space of the file" )
+{
+  BrickVolFile::Coordinates lower = { { 0, 0, 0 } };
+  BrickVolFile::Coordinates size  = { { 32, 32, 32 } };
+  BrickVolFile::Coordinates brick = { { 16, 16, 16 } };
+  std::vector<unsigned char> zeros( 16 * 16 * 16, 0 ), noise( zeros.size() ), blob, voxels;
+  for ( std::size_t j = 0; j < noise.size(); ++j )
+    noise[ j ] = static_cast<unsigned char>( ( j * 7919 ) ^ ( j >> 3 ) );
+
+  BrickVolFile file;
+  file.create( "brickvol-rewrite.bvol", lower, size, brick );
+  for ( std::size_t i = 0; i < file.nbBricks(); ++i )
+    {
+      file.encode( noise, blob );
+      file.writeBrick( i, blob );
+    }
+  std::vector<unsigned char> small, large;
+  file.encode( zeros, small );
+  file.encode( noise, large );
+  REQUIRE( small.size() < large.size() );
+
+  SECTION( "A brick that fits is rewritten in place, a larger one fills the gaps" )
+    {
+      std::FILE * f = std::fopen( "brickvol-rewrite.bvol", "rb" );
+      std::fseek( f, 0, SEEK_END );
+      const long initial = std::ftell( f );
+      std::fclose( f );
+      for ( unsigned int n = 0; n < 20; ++n )
+        for ( std::size_t i = 0; i < file.nbBricks(); ++i )
+          file.writeBrick( i, ( n + i ) % 2 == 0 ? small : large );
+      file.close();
+      f = std::fopen( "brickvol-rewrite.bvol", "rb" );
+      std::fseek( f, 0, SEEK_END );
+      const long rewritten = std::ftell( f );
+      std::fclose( f );
+      REQUIRE( rewritten == initial );
+
+      // Reopening finds the gaps again.
+      file.open( "brickvol-rewrite.bvol", true );
+      for ( std::size_t i = 0; i < file.nbBricks(); ++i )
+        file.writeBrick( i, small );
+      for ( std::size_t i = 0; i < file.nbBricks(); ++i )
+        file.writeBrick( i, large );
+      file.close();
+      f = std::fopen( "brickvol-rewrite.bvol", "rb" );
+      std::fseek( f, 0, SEEK_END );
+      REQUIRE( std::ftell( f ) == initial );
+      std::fclose( f );
+
+      file.open( "brickvol-rewrite.bvol" );
+      bool ok = true;
+      for ( std::size_t i = 0; i < file.nbBricks(); ++i )
+        {
+          file.readBrick( i, blob );
+          file.decode( i, blob, voxels );
+          ok = ok && voxels == noise;
+        }
+      REQUIRE( ok );
+    }
+}
+
+TEST_CASE( "ImageFactoryFromBrickVol" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CImageFactory< Factory > ));
+  const Image image = VolReader< Image >::importVol( testPath + "samples/cat10.vol" );
+  BrickVolWriter< Image >::exportBrickVol( "brickvol-factory.bvol", image, 16 );
+  const Z3i::Point low  = image.domain().lowerBound();
+  const Z3i::Domain sub( low + Z3i::Point( 5, 10, 15 ), low + Z3i::Point( 20, 18, 35 ) );
+
+  SECTION( "Requested images only cover their domain" )
+    {
+      Factory factory( "brickvol-factory.bvol" );
+      REQUIRE( factory.isValid() );
+      REQUIRE( factory.domain().lowerBound() == image.domain().lowerBound() );
+      REQUIRE( factory.brickSize() == Z3i::Point( 16, 16, 16 ) );
+      Image * part = factory.requestImage( sub );
+      REQUIRE( part->domain().upperBound() == sub.upperBound() );
+      REQUIRE( sameValues( image, *part ) );
+      // A read-only factory does not modify the file.
+      part->setValue( sub.lowerBound(), 255 - image( sub.lowerBound() ) );
+      factory.flushImage( part );
+      factory.detachImage( part );
+      const Image read = BrickVolReader< Image >::importBrickVol( "brickvol-factory.bvol" );
+      REQUIRE( sameValues( image, read ) );
+    }
+
+  SECTION( "Flushed images are written in the bricks" )
+    {
+      Image expected = image;
+      {
+        Factory factory( "brickvol-factory.bvol", true );
+        Image * part = factory.requestImage( sub );
+        for ( const Z3i::Point & p : sub )
+          if ( ( p[ 0 ] + p[ 1 ] + p[ 2 ] ) % 3 == 0 )
+            {
+              part->setValue( p, 200 );
+              expected.setValue( p, 200 );
+            }
+        factory.flushImage( part );
+        factory.detachImage( part );
+      }
+      const Image read = BrickVolReader< Image >::importBrickVol( "brickvol-factory.bvol" );
+      REQUIRE( sameValues( expected, read ) );
+    }
+
+  SECTION( "A TiledImage fetches its tiles from the bricks" )
+    {
+      typedef ImageCacheReadPolicyFIFO< Image, Factory > ReadPolicy;
+      typedef ImageCacheWritePolicyWB< Image, Factory >  WritePolicy;
+      typedef TiledImage< Image, Factory, ReadPolicy, WritePolicy > Tiled;
+      Factory factory( "brickvol-factory.bvol" );
+      ReadPolicy readPolicy( factory, 3 );
+      WritePolicy writePolicy( factory );
+      Tiled tiled( factory, readPolicy, writePolicy, 4 );
+      REQUIRE( sameValues( tiled, image ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkPointVector.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Micro-benchmark of the PointVector arithmetic: specialized versions
+ * (unrolled / packed) against the generic per-component loops, on the
+ * operations used by VoronoiMap (differences, squared distances,
+ * bounding boxes) and by Surfaces (inclusion tests, cross products).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/PointVectorArithmetic.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Array type that does not match the specializations of
+/// detail::PointVectorArithmetic, i.e. that gets the generic loops.
+template <typename T, std::size_t N>
+struct LoopArray : public std::array<T, N> {};
+
+template <Dimension dim, typename T>
+struct Specialized
+{
+  typedef std::array<T, dim> Container;
+  typedef detail::PointVectorArithmetic<dim, T, Container> Arithmetic;
+};
+
+template <Dimension dim, typename T>
+struct Generic
+{
+  typedef LoopArray<T, dim> Container;
+  typedef detail::PointVectorArithmetic<dim, T, Container> Arithmetic;
+};
+
+template <typename Container>
+std::vector<Container> randomPoints( std::size_t n )
+{
+  std::vector<Container> points( n );
+  for ( std::size_t i = 0; i < n; ++i )
+    for ( std::size_t k = 0; k < points[ i ].size(); ++k )
+      points[ i ][ k ] = static_cast<typename Container::value_type>( rand() % 2048 - 1024 );
+  return points;
+}
+
+/// VoronoiMap-like kernel: squared distance from a site to many points.
+template <typename Q>
+static void BM_SquaredDistance(benchmark::State& state)
+{
+  typedef typename Q::Container Container;
+  typedef typename Q::Arithmetic Arithmetic;
+  const std::vector<Container> points = randomPoints<Container>( state.range(0) );
+  const Container site = points[ 0 ];
+  while (state.KeepRunning())
+    {
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        {
+          Container d = points[ i ];
+          Arithmetic::subTo( d, site );
+          benchmark::DoNotOptimize( Arithmetic::dot( d, d ) );
+        }
+    }
+  state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+/// Bounding box of a point cloud (inf/sup), as in digital set services.
+template <typename Q>
+static void BM_BoundingBox(benchmark::State& state)
+{
+  typedef typename Q::Container Container;
+  typedef typename Q::Arithmetic Arithmetic;
+  const std::vector<Container> points = randomPoints<Container>( state.range(0) );
+  while (state.KeepRunning())
+    {
+      Container lower = points[ 0 ];
+      Container upper = points[ 0 ];
+      for ( std::size_t i = 1; i < points.size(); ++i )
+        {
+          Arithmetic::infWith( lower, points[ i ] );
+          Arithmetic::supWith( upper, points[ i ] );
+        }
+      benchmark::DoNotOptimize( lower );
+      benchmark::DoNotOptimize( upper );
+    }
+  state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+/// Translation of a point cloud followed by a domain inclusion test,
+/// as in surfel tracking.
+template <typename Q>
+static void BM_TranslateAndTest(benchmark::State& state)
+{
+  typedef typename Q::Container Container;
+  typedef typename Q::Arithmetic Arithmetic;
+  const std::vector<Container> points = randomPoints<Container>( state.range(0) );
+  Container lower = points[ 0 ], upper = points[ 0 ], shift = points[ 1 ];
+  for ( std::size_t k = 0; k < lower.size(); ++k )
+    { lower[ k ] = -512; upper[ k ] = 512; shift[ k ] = 1; }
+  while (state.KeepRunning())
+    {
+      unsigned int nb = 0;
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        {
+          Container p = points[ i ];
+          Arithmetic::addTo( p, shift );
+          nb += ( Arithmetic::isLower( lower, p ) && Arithmetic::isLower( p, upper ) ) ? 1 : 0;
+        }
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Generic<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Specialized<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Generic<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Specialized<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Generic<3, DGtal::int64_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Specialized<3, DGtal::int64_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Generic<3, double>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SquaredDistance, Specialized<3, double>)->Arg(1 << 14);
+
+BENCHMARK_TEMPLATE(BM_BoundingBox, Generic<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Specialized<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Generic<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Specialized<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Generic<2, double>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Specialized<2, double>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Generic<3, double>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_BoundingBox, Specialized<3, double>)->Arg(1 << 14);
+
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Generic<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Specialized<2, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Generic<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Specialized<3, DGtal::int32_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Generic<3, DGtal::int64_t>)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_TranslateAndTest, Specialized<3, DGtal::int64_t>)->Arg(1 << 14);
+
+/// End-to-end PointVector operations (what the library code calls).
+template <typename Point>
+static void BM_PointVectorOperations(benchmark::State& state)
+{
+  std::vector<Point> points( state.range(0) );
+  for ( std::size_t i = 0; i < points.size(); ++i )
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      points[ i ][ k ] = static_cast<typename Point::Component>( rand() % 2048 - 1024 );
+  while (state.KeepRunning())
+    {
+      Point lower = points[ 0 ], upper = points[ 0 ];
+      typename Point::Component acc = 0;
+      for ( std::size_t i = 1; i < points.size(); ++i )
+        {
+          const Point d = points[ i ] - points[ i - 1 ];
+          acc += d.dot( d );
+          lower = lower.inf( points[ i ] );
+          upper = upper.sup( points[ i ] );
+        }
+      benchmark::DoNotOptimize( acc );
+      benchmark::DoNotOptimize( lower );
+      benchmark::DoNotOptimize( upper );
+    }
+  state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+BENCHMARK_TEMPLATE(BM_PointVectorOperations, SpaceND<2>::Point)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_PointVectorOperations, SpaceND<3>::Point)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_PointVectorOperations, SpaceND<3>::RealPoint)->Arg(1 << 14);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char**argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <string>
 #include <unordered_set>
+#include <type_traits>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -52,12 +53,21 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/sets/DigitalSetByOpenAddressing.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/kernel/sets/DigitalSetInserter.h"
 
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 
 #include "DGtal/helpers/StdDefs.h"
 
@@ -363,6 +373,280 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByBitsetOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitset<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+
+  trace.beginBlock ( "DigitalSetByBitset word-wide operations" );
+  // 7x5x3=105 points: the last word is partially used.
+  Domain domain( Point( -3, -2, -1 ), Point( 3, 2, 1 ) );
+  BitSet ball( domain ), slab( domain );
+  RefSet refBall( domain ), refSlab( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( (*it).norm() <= 2.5 ) { ball.insert( *it ); refBall.insert( *it ); }
+      if ( (*it)[ 0 ] >= 0 )     { slab.insert( *it ); refSlab.insert( *it ); }
+    }
+  INBLOCK_TEST( ball.size() == refBall.size() );
+
+  // Iteration follows the domain order.
+  std::vector<Point> fromBitset( ball.begin(), ball.end() );
+  std::vector<Point> fromDomain;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( refBall( *it ) ) fromDomain.push_back( *it );
+  INBLOCK_TEST( fromBitset == fromDomain );
+
+  BitSet u( ball );   u |= slab;
+  BitSet i( ball );   i &= slab;
+  BitSet d( ball );   d -= slab;
+  unsigned int nbU = 0, nbI = 0, nbD = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const bool inB = refBall( *it ), inS = refSlab( *it );
+      nbU += ( u( *it ) == ( inB || inS ) ) ? 1 : 0;
+      nbI += ( i( *it ) == ( inB && inS ) ) ? 1 : 0;
+      nbD += ( d( *it ) == ( inB && ! inS ) ) ? 1 : 0;
+    }
+  INBLOCK_TEST( nbU == domain.size() && nbI == domain.size() && nbD == domain.size() );
+  INBLOCK_TEST( u.size() + i.size() == ball.size() + slab.size() );
+  INBLOCK_TEST( d.size() + i.size() == ball.size() );
+
+  BitSet c( domain );
+  c.assignFromComplement( ball );
+  INBLOCK_TEST( c.isValid() && c.size() + ball.size() == domain.size() );
+  c &= ball;
+  INBLOCK_TEST( c.empty() && c.begin() == c.end() );
+
+  // Set on a sub-domain: operations fall back to point-wise ones.
+  Domain small( Point( 2, 1, 0 ), Point( 3, 2, 1 ) );
+  BitSet cube( small );
+  for ( Domain::ConstIterator it = small.begin(); it != small.end(); ++it )
+    cube.insertNew( *it );
+  BitSet big( ball );
+  big += cube;
+  INBLOCK_TEST( big.size() == ball.size() + 6 ); // only (2,1,0) and (2,1,1) are in ball.
+  INBLOCK_TEST( ! big( Point( 10, 0, 0 ) ) && big.find( Point( 10, 0, 0 ) ) == big.end() );
+
+  Point lo, up;
+  d.computeBoundingBox( lo, up );
+  INBLOCK_TEST( lo == Point( -2, -2, -1 ) && up == Point( -1, 2, 1 ) );
+
+  // Points outside the domain are not stored.
+  BitSet outside( small );
+  outside.insert( Point( 10, 0, 0 ) );
+  outside.insertNew( Point( -10, 0, 0 ) );
+  INBLOCK_TEST( outside.empty() && outside.isValid() );
+
+  // The bitset is opt-in: the default selection stays a hash set.
+  INBLOCK_TEST(( std::is_same< DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS + BITSET_DS >::Type,
+                               BitSet >::value ));
+  INBLOCK_TEST(( ! std::is_same< DigitalSetSelector< Domain, WHOLE_DS + HIGH_BEL_DS >::Type,
+                                 BitSet >::value ));
+  INBLOCK_TEST(( ! std::is_same< Z3i::DigitalSet, BitSet >::value ));
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testDigitalSetByRuns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByRuns<Domain> RunSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate< RunSet > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< RunSet > ));
+
+  trace.beginBlock ( "DigitalSetByRuns run-wise operations" );
+  Domain domain( Point( -6, -4, -2 ), Point( 7, 4, 2 ) );
+  RefSet refBall( domain ), refSlab( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( (*it).norm() <= 4.5 ) refBall.insert( *it );
+      if ( ( (*it)[ 0 ] + (*it)[ 1 ] ) % 3 != 0 ) refSlab.insert( *it );
+    }
+  const RunSet ball( domain, refBall ), slab( domain, refSlab );
+  INBLOCK_TEST( ball.isValid() && slab.isValid() );
+  INBLOCK_TEST( ball.size() == refBall.size() && slab.size() == refSlab.size() );
+  INBLOCK_TEST( ball.nbSpans() < ball.size() / 4 );
+
+  // Iteration follows the domain order, spans cover the points.
+  std::vector<Point> fromRuns( ball.begin(), ball.end() );
+  std::vector<Point> fromDomain, fromSpans;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( refBall( *it ) ) fromDomain.push_back( *it );
+  for ( RunSet::SpanConstIterator it = ball.spanBegin(); it != ball.spanEnd(); ++it )
+    for ( Point p = it->first; p[ 0 ] <= it->last[ 0 ]; ++p[ 0 ] )
+      fromSpans.push_back( p );
+  INBLOCK_TEST( fromRuns == fromDomain && fromSpans == fromDomain );
+  INBLOCK_TEST( *ball.find( Point( 1, 2, 0 ) ) == Point( 1, 2, 0 ) );
+  INBLOCK_TEST( ball.find( Point( 6, 0, 0 ) ) == ball.end() );
+  INBLOCK_TEST( std::distance( ball.find( fromDomain[ 5 ] ), ball.end() )
+                == static_cast<std::ptrdiff_t>( fromDomain.size() - 5 ) );
+
+  RunSet u( ball );   u |= slab;
+  RunSet i( ball );   i &= slab;
+  RunSet d( ball );   d -= slab;
+  unsigned int nbU = 0, nbI = 0, nbD = 0, nbImage = 0;
+  RunSet::ConstRange::ConstIterator itValue = ball.constRange().begin();
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it, ++itValue )
+    {
+      const bool inB = refBall( *it ), inS = refSlab( *it );
+      nbU += ( u( *it ) == ( inB || inS ) ) ? 1 : 0;
+      nbI += ( i( *it ) == ( inB && inS ) ) ? 1 : 0;
+      nbD += ( d( *it ) == ( inB && ! inS ) ) ? 1 : 0;
+      nbImage += ( *itValue == inB ) ? 1 : 0;
+    }
+  INBLOCK_TEST( nbU == domain.size() && nbI == domain.size() && nbD == domain.size() );
+  INBLOCK_TEST( nbImage == domain.size() );
+  INBLOCK_TEST( u.isValid() && i.isValid() && d.isValid() );
+  INBLOCK_TEST( u.size() + i.size() == ball.size() + slab.size() );
+
+  RunSet c( domain );
+  c.assignFromComplement( ball );
+  INBLOCK_TEST( c.isValid() && c.size() + ball.size() == domain.size() );
+  std::vector<Point> complement;
+  std::back_insert_iterator< std::vector<Point> > ito( complement );
+  ball.computeComplement( ito );
+  INBLOCK_TEST( complement == std::vector<Point>( c.begin(), c.end() ) );
+  c &= ball;
+  INBLOCK_TEST( c.empty() && c.begin() == c.end() );
+
+  // Set on a sub-domain.
+  Domain small( Point( 3, 1, 0 ), Point( 9, 2, 1 ) );
+  RunSet cube( small, small.predicate() );
+  RunSet big( ball );
+  big += cube;
+  INBLOCK_TEST( big.isValid() && big( Point( 5, 2, 1 ) ) && ! big( Point( 9, 0, 0 ) ) );
+
+  Point lo, up;
+  ball.computeBoundingBox( lo, up );
+  INBLOCK_TEST( lo == Point( -4, -4, -2 ) && up == Point( 4, 4, 2 ) );
+
+  // From a thresholded image, in one scan.
+  typedef ImageContainerBySTLVector<Domain, int> Image;
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    image.setValue( *it, refBall( *it ) ? 10 : 0 );
+  const RunSet thresholded( domain, functors::SimpleThresholdForegroundPredicate<Image>( image, 5 ) );
+  INBLOCK_TEST( std::vector<Point>( thresholded.begin(), thresholded.end() ) == fromDomain );
+  trace.endBlock();
+
+  trace.beginBlock ( "DigitalSetByRuns with shapes and distance transformation" );
+  typedef Z2i::Domain Domain2;
+  typedef ImplicitBall<Z2i::Space> Ball;
+  Domain2 domain2( Z2i::Point( -20, -20 ), Z2i::Point( 20, 20 ) );
+  Ball disk( Z2i::RealPoint( 2.5, -1.0 ), 12.3 );
+  DigitalSetByRuns<Domain2> runs( domain2 );
+  DigitalSetBySTLSet<Domain2> ref( domain2 );
+  Shapes<Domain2>::euclideanShaper( runs, disk );
+  Shapes<Domain2>::euclideanShaper( ref, disk );
+  std::vector<Z2i::Point> fromShaper( runs.begin(), runs.end() );
+  std::sort( fromShaper.begin(), fromShaper.end() );
+  INBLOCK_TEST( runs.size() == ref.size()
+                && std::equal( ref.begin(), ref.end(), fromShaper.begin() ) );
+
+  // Boxes and shapes that overlap the domain along x only add nothing.
+  DigitalSetByRuns<Domain2> outside( runs );
+  outside.assignFromPredicate( domain2.predicate(), Z2i::Point( 2, 21 ), Z2i::Point( 5, 25 ) );
+  INBLOCK_TEST( outside.isValid() && outside.empty() );
+  outside.assignFromPredicate( domain2.predicate(), Z2i::Point( 2, -25 ), Z2i::Point( 5, -21 ) );
+  INBLOCK_TEST( outside.isValid() && outside.empty() );
+  DigitalSetByRuns<Domain2> shifted( runs );
+  Shapes<Domain2>::euclideanShaper( shifted, Ball( Z2i::RealPoint( 2.5, 30.0 ), 5.0 ) );
+  Shapes<Domain2>::euclideanShaper( shifted, Ball( Z2i::RealPoint( 2.5, -30.0 ), 5.0 ) );
+  INBLOCK_TEST( shifted.isValid() && shifted.size() == runs.size() );
+
+  typedef DistanceTransformation<Z2i::Space, DigitalSetByRuns<Domain2>, Z2i::L2Metric> DTRuns;
+  typedef DistanceTransformation<Z2i::Space, DigitalSetBySTLSet<Domain2>, Z2i::L2Metric> DTRef;
+  DTRuns dtRuns( domain2, runs, Z2i::l2Metric );
+  DTRef dtRef( domain2, ref, Z2i::l2Metric );
+  INBLOCK_TEST( std::equal( dtRef.constRange().begin(), dtRef.constRange().end(),
+                            dtRuns.constRange().begin() ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testDigitalSetByOpenAddressing()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByOpenAddressing<Domain> HashSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+
+  trace.beginBlock ( "DigitalSetByOpenAddressing bulk insertion and erasure" );
+  // Sparse points in a large domain.
+  Domain domain( Point::diagonal( -100000 ), Point::diagonal( 100000 ) );
+  std::vector<Point> points;
+  for ( int i = 0; i < 2000; ++i )
+    points.push_back( Point( ( i * 7919 ) % 200001 - 100000,
+                             ( i * 104729 ) % 200001 - 100000,
+                             i % 3 ) );
+
+  // Unsorted range, inserted twice.
+  HashSet unsorted( domain );
+  RefSet ref( domain );
+  unsorted.insert( points.begin(), points.end() );
+  unsorted.insert( points.begin(), points.end() );
+  ref.insert( points.begin(), points.end() );
+  INBLOCK_TEST( unsorted.size() == ref.size() && unsorted.isValid() );
+
+  // Sorted range with consecutive duplicates.
+  std::vector<Point> sorted( points );
+  sorted.insert( sorted.end(), points.begin(), points.end() );
+  std::sort( sorted.begin(), sorted.end() );
+  HashSet fromSorted( domain );
+  fromSorted.insert( sorted.begin(), sorted.end() );
+  INBLOCK_TEST( fromSorted.size() == ref.size() && fromSorted.isValid() );
+
+  // No rehash once enough room is reserved.
+  HashSet reserved( domain );
+  reserved.reserve( ref.size() );
+  const HashSet::Size capacity = reserved.capacity();
+  reserved.insertNew( ref.begin(), ref.end() );
+  INBLOCK_TEST( reserved.size() == ref.size() && reserved.capacity() == capacity );
+
+  unsigned int nbFound = 0;
+  for ( RefSet::ConstIterator it = ref.begin(); it != ref.end(); ++it )
+    nbFound += ( fromSorted( *it ) && *fromSorted.find( *it ) == *it ) ? 1 : 0;
+  INBLOCK_TEST( nbFound == ref.size() );
+  INBLOCK_TEST( ! fromSorted( Point( 1, 2, 5 ) ) && fromSorted.find( Point( 1, 2, 5 ) ) == fromSorted.end() );
+
+  // Erase and insert again: erased slots are recycled.
+  for ( unsigned int k = 0; k < 10; ++k )
+    {
+      for ( std::size_t i = k % 2; i < points.size(); i += 2 )
+        reserved.erase( points[ i ] );
+      for ( std::size_t i = k % 2; i < points.size(); i += 2 )
+        reserved.insert( points[ i ] );
+    }
+  INBLOCK_TEST( reserved.size() == ref.size() && reserved.isValid()
+                && reserved.capacity() == capacity );
+
+  std::vector<Point> iterated( reserved.begin(), reserved.end() );
+  std::sort( iterated.begin(), iterated.end() );
+  INBLOCK_TEST( std::equal( iterated.begin(), iterated.end(), ref.begin() ) );
+
+  fromSorted.erase( fromSorted.begin(), fromSorted.end() );
+  INBLOCK_TEST( fromSorted.empty() && fromSorted.begin() == fromSorted.end() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -424,6 +708,22 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, ContainerU>(domain), DigitalSetByAssociativeContainer<Domain, ContainerU>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitset" );
+  bool okBitset = testDigitalSet< DigitalSetByBitset<Domain> >
+  ( DigitalSetByBitset<Domain>(domain), DigitalSetByBitset<Domain>(domain) );
+  trace.endBlock();
+
+  bool okBitsetOperations = testDigitalSetByBitsetOperations();
+
+  trace.beginBlock( "DigitalSetByOpenAddressing" );
+  bool okOpenAddressing = testDigitalSet< DigitalSetByOpenAddressing<Domain> >
+  ( DigitalSetByOpenAddressing<Domain>(domain), DigitalSetByOpenAddressing<Domain>(domain) );
+  trace.endBlock();
+
+  bool okOpenAddressingBulk = testDigitalSetByOpenAddressing();
+
+  bool okRuns = testDigitalSetByRuns();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -445,7 +745,8 @@ int main()
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet && okBitset && okBitsetOperations
+     && okOpenAddressing && okOpenAddressingBulk && okRuns;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
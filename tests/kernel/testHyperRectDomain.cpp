@@ -35,6 +35,7 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <vector>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -285,6 +286,78 @@ bool testSTLCompat()
   return myHyperRectDomain4D.isValid();
 }
 
+bool testRandomAccess()
+{
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Random-access iterators" );
+  const Domain domain( Point( -1, 2, 0 ), Point( 3, 4, 3 ) );
+  const std::ptrdiff_t size = static_cast<std::ptrdiff_t>( domain.size() );
+
+  // Advancing by k points is the same as incrementing k times.
+  bool ok = ( domain.end() - domain.begin() == size );
+  std::ptrdiff_t k = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it, ++k )
+    ok = ok && ( domain.begin() + k == it ) && ( it - domain.begin() == k )
+            && ( domain.begin()[ k ] == *it ) && ( domain.end() - ( size - k ) == it )
+            && ( domain.begin() < domain.end() - ( size - k ) + 1 )
+            && ! ( it < it ) && ( it <= it );
+  ok = ok && ( domain.begin() + size == domain.end() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") domain iterator" << std::endl;
+
+  ok = ( domain.rend() - domain.rbegin() == size );
+  k = 0;
+  for ( Domain::ConstReverseIterator it = domain.rbegin(); it != domain.rend(); ++it, ++k )
+    ok = ok && ( *( domain.rbegin() + k ) == *it ) && ( domain.rbegin() < domain.rend() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") reverse iterator" << std::endl;
+
+  // Sub-range with a starting point, dimensions in a permuted order.
+  const Domain::ConstSubRange range = domain.subRange( { 2, 0 }, Point( -1, 3, 0 ) );
+  ok = ( range.end() - range.begin() == 20 );
+  k = 0;
+  for ( Domain::ConstSubRange::ConstIterator it = range.begin(); it != range.end(); ++it, ++k )
+    ok = ok && ( range.begin() + k == it ) && ( it - range.begin() == k )
+            && ( (*it)[ 1 ] == 3 ) && ( range.begin()[ k ] == *it );
+  ok = ok && ( k == 20 ) && ( range.end() - 20 == range.begin() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sub-range iterator" << std::endl;
+
+  // Balanced splits cover the whole scan, in order.
+  std::vector<Point> points;
+  const std::vector<Domain::ConstSplitRange> parts = domain.split( 7 );
+  ok = ( parts.size() == 7 );
+  for ( std::size_t i = 0; i < parts.size(); ++i )
+    {
+      ok = ok && ( parts[ i ].size() == size / 7 || parts[ i ].size() == size / 7 + 1 );
+      for ( Domain::ConstIterator it = parts[ i ].begin(); it != parts[ i ].end(); ++it )
+        points.push_back( *it );
+    }
+  ok = ok && std::equal( points.begin(), points.end(), domain.begin() )
+          && ( points.size() == domain.size() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") domain split" << std::endl;
+
+  const std::vector<Domain::ConstSubRange::ConstSplitRange> subParts = range.split( 32 );
+  std::ptrdiff_t nbPoints = 0, nbEmpty = 0;
+  for ( std::size_t i = 0; i < subParts.size(); ++i )
+    {
+      nbPoints += subParts[ i ].size();
+      nbEmpty  += subParts[ i ].size() == 0 ? 1 : 0;
+    }
+  ok = ( nbPoints == 20 ) && ( nbEmpty == 12 ) && ( subParts.back().end() == range.end() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sub-range split" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testEmptyDomain()
 {
   typedef SpaceND<3> TSpace;
@@ -314,6 +387,9 @@ bool testEmptyDomain()
   ++nb; nbok += domain.begin() == domain.end() ? 1 : 0;
   trace.info() << "(" << nbok << "/" << nb << ") Checking that begin() == end()" << std::endl;
 
+  ++nb; nbok += ( domain.end() - domain.begin() == 0 && domain.split( 3 ).back().size() == 0 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") Checking that end() - begin() == 0" << std::endl;
+
   ++nb; nbok += domain.rbegin() == domain.rend() ? 1 : 0;
   trace.info() << "(" << nbok << "/" << nb << ") Checking that rbegin() == rend()" << std::endl;
 
@@ -359,7 +435,8 @@ bool testEmptyDomain()
 
 int main()
 {
-  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testEmptyDomain() )
+  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testEmptyDomain()
+       && testRandomAccess() )
     return 0;
   else
     return 1;
@@ -31,6 +31,8 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <fstream>
@@ -285,6 +287,69 @@ bool testIntegerNorms()
   return nbok == nb;
 }
 
+/**
+ * Checks the 2D/3D specialized arithmetic against per-component
+ * computations.
+ */
+template <typename Point>
+unsigned int checkSpecializedOperators( unsigned int & nb )
+{
+  typedef typename Point::Component Component;
+  unsigned int nbok = 0;
+  for ( unsigned int n = 0; n < 100; ++n )
+    {
+      Point a, b;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        {
+          a[ k ] = static_cast<Component>( rand() % 200 - 100 ) / 4;
+          b[ k ] = static_cast<Component>( rand() % 200 - 100 ) / 4;
+        }
+      Point sum = a + b, diff = a - b, neg = -a, low = a.inf( b ), up = a.sup( b );
+      Point scaled = a; scaled *= b[ 0 ];
+      Component dot = NumberTraits<Component>::ZERO;
+      double n2 = 0.0;
+      bool ok = true;
+      bool lower = true;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        {
+          ok = ok && sum[ k ] == a[ k ] + b[ k ] && diff[ k ] == a[ k ] - b[ k ]
+            && neg[ k ] == -a[ k ] && scaled[ k ] == a[ k ] * b[ 0 ]
+            && low[ k ] == std::min( a[ k ], b[ k ] )
+            && up[ k ] == std::max( a[ k ], b[ k ] );
+          dot += a[ k ] * b[ k ];
+          n2 += NumberTraits<Component>::castToDouble( a[ k ] )
+            * NumberTraits<Component>::castToDouble( a[ k ] );
+          lower = lower && ! ( b[ k ] < a[ k ] );
+        }
+      ok = ok && a.dot( b ) == dot && a.norm() == std::sqrt( n2 )
+        && a.isLower( b ) == lower && low.isLower( a ) && up.isUpper( b );
+      ++nb; nbok += ok ? 1 : 0;
+    }
+  return nbok;
+}
+
+bool testSpecializedOperators()
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  trace.beginBlock("2D/3D specialized operators");
+  nbok += checkSpecializedOperators< PointVector<2, DGtal::int32_t> >( nb );
+  nbok += checkSpecializedOperators< PointVector<3, DGtal::int32_t> >( nb );
+  nbok += checkSpecializedOperators< PointVector<3, DGtal::int64_t> >( nb );
+  nbok += checkSpecializedOperators< PointVector<2, double> >( nb );
+  nbok += checkSpecializedOperators< PointVector<3, double> >( nb );
+  trace.info() << "(" << nbok << "/" << nb << ") random points" << std::endl;
+
+  PointVector<3, double> u( 1.5, -2.0, 0.25 ), v( -0.5, 3.0, 2.0 );
+  PointVector<3, double> w = u.crossProduct( v );
+  ++nb; nbok += ( w[ 0 ] == u[ 1 ]*v[ 2 ] - u[ 2 ]*v[ 1 ]
+                  && w[ 1 ] == u[ 2 ]*v[ 0 ] - u[ 0 ]*v[ 2 ]
+                  && w[ 2 ] == u[ 0 ]*v[ 1 ] - u[ 1 ]*v[ 0 ] ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") u x v = " << w << std::endl;
+  trace.endBlock();
+  return nb == nbok;
+}
+
 int main()
 {
   bool res;
@@ -295,6 +360,7 @@ int main()
     && testComparison()
     && testOperators()
     && testIntegerNorms()
+    && testSpecializedOperators()
     && testMaxMin();
   if (res)
     return 0;
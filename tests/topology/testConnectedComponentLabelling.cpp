@@ -0,0 +1,189 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ConnectedComponentLabelling and its use
+ * by Object::writeComponents.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DomainAdjacency.h"
+#include "DGtal/topology/DigitalTopology.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Random set of the given density (in percent) inside the domain.
+template <typename Domain>
+typename DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS >::Type
+randomSet( const Domain & domain, int density )
+{
+  typename DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS >::Type set( domain );
+  for ( auto const & p : domain )
+    if ( rand() % 100 < density ) set.insertNew( p );
+  return set;
+}
+
+/**
+ * Compares the components written by an object whose adjacency is
+ * labelled by ConnectedComponentLabelling with those written by the
+ * breadth-first traversals of the same object seen through a domain
+ * adjacency, and checks the labelling of its bounding domain.
+ */
+template <Dimension maxNorm1, typename Domain, typename DigitalSet>
+void checkComponents( const Domain & domain, const DigitalSet & set )
+{
+  typedef typename Domain::Space Space;
+  typedef MetricAdjacency< Space, maxNorm1 > Adj;
+  typedef MetricAdjacency< Space, 1 > Adj1;
+  typedef DomainAdjacency< Domain, Adj > DomAdj;
+  typedef DomainAdjacency< Domain, Adj1 > DomAdj1;
+  typedef DigitalTopology< Adj, Adj1 > DT;
+  typedef DigitalTopology< DomAdj, DomAdj1 > DomDT;
+  typedef Object< DT, DigitalSet > FastObject;
+  typedef Object< DomDT, DigitalSet > BFSObject;
+  REQUIRE( IsTranslationInvariantAdjacency< Adj >::value );
+  REQUIRE( ! IsTranslationInvariantAdjacency< DomAdj >::value );
+
+  Adj adj; Adj1 adj1;
+  DomAdj domAdj( domain, adj ); DomAdj1 domAdj1( domain, adj1 );
+  FastObject fast( DT( adj, adj1, JORDAN_DT ), set );
+  BFSObject  bfs( DomDT( domAdj, domAdj1, JORDAN_DT ), set );
+  std::vector< FastObject > fastComponents;
+  std::vector< BFSObject > bfsComponents;
+  auto fastIt = std::back_inserter( fastComponents );
+  auto bfsIt  = std::back_inserter( bfsComponents );
+  const auto nbFast = fast.writeComponents( fastIt );
+  const auto nbBFS  = bfs.writeComponents( bfsIt );
+  REQUIRE( nbFast == nbBFS );
+  REQUIRE( fastComponents.size() == bfsComponents.size() );
+  unsigned int nbok = 0;
+  for ( std::size_t i = 0; i < fastComponents.size(); ++i )
+    {
+      const DigitalSet & a = fastComponents[ i ].pointSet();
+      const DigitalSet & b = bfsComponents[ i ].pointSet();
+      bool ok = a.size() == b.size();
+      for ( auto const & p : a ) ok = ok && b.find( p ) != b.end();
+      nbok += ok ? 1 : 0;
+    }
+  REQUIRE( nbok == fastComponents.size() );
+
+  ConnectedComponentLabelling< Space > ccl( domain, adj );
+  REQUIRE( ccl.isValid() );
+  ccl.compute( [ &set ] ( const typename Space::Point & p )
+               { return set.find( p ) != set.end(); } );
+  REQUIRE( ccl.nbComponents() == nbBFS );
+  REQUIRE( ccl.size( 0 ) == domain.size() - set.size() );
+  std::size_t total = 0;
+  for ( auto s : ccl.sizes() ) total += s;
+  REQUIRE( total == domain.size() );
+  // Every component is a single label.
+  for ( std::size_t i = 0; i < bfsComponents.size(); ++i )
+    {
+      const DigitalSet & b = bfsComponents[ i ].pointSet();
+      const auto l = ccl.label( *b.begin() );
+      unsigned int nbSame = 0;
+      for ( auto const & p : b ) nbSame += ccl.label( p ) == l ? 1 : 0;
+      REQUIRE( nbSame == b.size() );
+      REQUIRE( ccl.size( l ) == b.size() );
+    }
+}
+
+TEST_CASE( "Backward neighborhoods" )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 3 ) );
+  REQUIRE( ConnectedComponentLabelling< Z3i::Space >( domain, Z3i::Adj6() ).backwardNeighborhood().size() == 3 );
+  REQUIRE( ConnectedComponentLabelling< Z3i::Space >( domain, Z3i::Adj18() ).backwardNeighborhood().size() == 9 );
+  REQUIRE( ConnectedComponentLabelling< Z3i::Space >( domain, Z3i::Adj26() ).backwardNeighborhood().size() == 13 );
+  Z2i::Domain domain2( Z2i::Point( 0, 0 ), Z2i::Point( 3, 3 ) );
+  REQUIRE( ConnectedComponentLabelling< Z2i::Space >( domain2, Z2i::Adj4() ).backwardNeighborhood().size() == 2 );
+  REQUIRE( ConnectedComponentLabelling< Z2i::Space >( domain2, Z2i::Adj8() ).backwardNeighborhood().size() == 4 );
+}
+
+TEST_CASE( "Components of random 2D sets" )
+{
+  srand( 0 );
+  Z2i::Domain domain( Z2i::Point( -7, -5 ), Z2i::Point( 33, 28 ) );
+  for ( int density : { 20, 45, 60 } )
+    {
+      const auto set = randomSet( domain, density );
+      checkComponents< 1 >( domain, set );
+      checkComponents< 2 >( domain, set );
+    }
+}
+
+TEST_CASE( "Components of random 3D sets" )
+{
+  srand( 0 );
+  Z3i::Domain domain( Z3i::Point( -4, -2, -6 ), Z3i::Point( 12, 9, 11 ) );
+  for ( int density : { 15, 30, 50 } )
+    {
+      const auto set = randomSet( domain, density );
+      checkComponents< 1 >( domain, set );
+      checkComponents< 2 >( domain, set );
+      checkComponents< 3 >( domain, set );
+    }
+}
+
+TEST_CASE( "Labelling of a binary image" )
+{
+  typedef ImageContainerBySTLVector< Z3i::Domain, bool > BinaryImage;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 9, 9 ) );
+  BinaryImage image( domain );
+  // Two balls touching by a corner.
+  for ( auto const & p : domain )
+    image.setValue( p, ( p - Z3i::Point( 2, 2, 2 ) ).norm() <= 2.0
+                    || ( p - Z3i::Point( 6, 6, 6 ) ).norm() <= 2.0 );
+  ConnectedComponentLabelling< Z3i::Space > ccl6( domain, Z3i::Adj6() );
+  ccl6.compute( image );
+  REQUIRE( ccl6.nbComponents() == 2 );
+  REQUIRE( ccl6.label( Z3i::Point( 2, 2, 2 ) ) == 1 );
+  REQUIRE( ccl6.label( Z3i::Point( 6, 6, 6 ) ) == 2 );
+  REQUIRE( ccl6.label( Z3i::Point( 9, 0, 0 ) ) == ccl6.background );
+  REQUIRE( ccl6.size( 1 ) == ccl6.size( 2 ) );
+  image.setValue( Z3i::Point( 4, 4, 4 ), true );
+  ConnectedComponentLabelling< Z3i::Space > ccl26( domain, Z3i::Adj26() );
+  REQUIRE( ccl26.compute( image ) == 1 );
+  REQUIRE( ccl26.size( 1 ) == 2 * ccl6.size( 1 ) + 1 );
+  REQUIRE( ccl6.compute( image ) == 3 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCubicalCellFlatMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class CubicalCellFlatMap, alone and as the
+ * cell container of CubicalComplex.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/CubicalCellFlatMap.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CubicalCellFlatMap.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef KhalimskySpaceND<3>                              KSpace;
+typedef KSpace::Point                                    Point;
+typedef KSpace::Cell                                     Cell;
+typedef KSpace::Integer                                  Integer;
+typedef CubicalCellFlatMap< KSpace, CubicalCellData >    FlatMap;
+typedef std::map< Cell, CubicalCellData >                Map;
+typedef CubicalComplex< KSpace, FlatMap >                FlatCC;
+typedef CubicalComplex< KSpace, Map >                    MapCC;
+
+/// @return the cells of a complex, as a set.
+template <typename CC>
+std::set< Cell > cellsOf( const CC & complex )
+{
+  return std::set< Cell >( complex.begin(), complex.end() );
+}
+
+/// @return true if calling @a f throws an exception of type TException.
+template <typename TException, typename TFunction>
+bool throws( TFunction f )
+{
+  try { f(); }
+  catch ( const TException & ) { return true; }
+  return false;
+}
+
+/// Inserts the same random spels in both complexes.
+void randomSpels( const KSpace & K, FlatCC & flat, MapCC & map, int nb, unsigned int seed )
+{
+  srand( seed );
+  const Point up = K.upperBound();
+  for ( int n = 0; n < nb; ++n )
+    {
+      Point p( rand() % ( up[ 0 ] + 1 ), rand() % ( up[ 1 ] + 1 ), rand() % ( up[ 2 ] + 1 ) );
+      flat.insertCell( K.uSpel( p ) );
+      map.insertCell( K.uSpel( p ) );
+    }
+}
+
+TEST_CASE( "CubicalCellFlatMap as an associative container" )
+{
+  KSpace K;
+  K.init( Point( -2, -1, 0 ), Point( 3, 4, 2 ), true );
+  const Point low = K.uKCoords( K.lowerCell() );
+  const Point up  = K.uKCoords( K.upperCell() );
+  HyperRectDomain< KSpace::Space > kdomain( low, up );
+  std::vector< FlatMap > maps;
+  for ( Dimension d = 0; d <= 3; ++d )
+    maps.push_back( FlatMap( K, d ) );
+
+  SECTION( "Every cell has its own slot in the map of its dimension" )
+    {
+      std::size_t nb = 0;
+      for ( const Point & kp : kdomain )
+        {
+          const Cell c = K.uCell( kp );
+          FlatMap & map = maps[ K.uDim( c ) ];
+          REQUIRE( map.count( c ) == 0 );
+          map[ c ].data = static_cast<uint32_t>( nb++ );
+          REQUIRE( map.count( c ) == 1 );
+          REQUIRE( map.find( c )->first == c );
+        }
+      std::size_t total = 0;
+      for ( Dimension d = 0; d <= 3; ++d )
+        {
+          REQUIRE( maps[ d ].isValid() );
+          REQUIRE( maps[ d ].size() == maps[ d ].capacity() );
+          total += maps[ d ].size();
+          for ( auto it = maps[ d ].begin(), itE = maps[ d ].end(); it != itE; ++it )
+            REQUIRE( K.uDim( it->first ) == d );
+        }
+      REQUIRE( total == kdomain.size() );
+      nb = 0;
+      bool ok = true;
+      for ( const Point & kp : kdomain )
+        {
+          const Cell c = K.uCell( kp );
+          ok = ok && maps[ K.uDim( c ) ].find( c )->second.data == nb++;
+        }
+      REQUIRE( ok );
+    }
+
+  SECTION( "Insertion and removal behave as with std::map" )
+    {
+      FlatMap & map = maps[ 1 ];
+      const Cell c1 = K.uCell( Point( 1, 2, 2 ) );
+      const Cell c2 = K.uCell( Point( -3, 4, 0 ) );
+      REQUIRE( map.insert( std::make_pair( c1, CubicalCellData( 3 ) ) ).second );
+      REQUIRE( ! map.insert( std::make_pair( c1, CubicalCellData( 4 ) ) ).second );
+      REQUIRE( map[ c1 ].data == 3 );
+      map.insert( map.end(), std::make_pair( c2, CubicalCellData( 5 ) ) );
+      REQUIRE( map.size() == 2 );
+      REQUIRE( map.equal_range( c2 ).first->second.data == 5 );
+      REQUIRE( map.erase( c1 ) == 1 );
+      REQUIRE( map.erase( c1 ) == 0 );
+      REQUIRE( map.find( c1 ) == map.end() );
+      map.erase( map.find( c2 ) );
+      REQUIRE( map.empty() );
+      REQUIRE( map.begin() == map.end() );
+      const FlatMap copy( map );
+      REQUIRE( copy.find( c2 ) == copy.end() );
+    }
+
+  SECTION( "Cells that the map cannot hold are rejected" )
+    {
+      FlatMap & map = maps[ 1 ];
+      const Cell spel = K.uCell( Point( 1, 1, 1 ) );
+      KSpace bigK;
+      bigK.init( Point( -2, -1, 0 ), Point( 10, 4, 2 ), true );
+      const Cell far  = bigK.uCell( Point( 13, 2, 2 ) );
+      REQUIRE( map.count( spel ) == 0 );
+      REQUIRE( map.find( spel ) == map.end() );
+      REQUIRE( map.erase( spel ) == 0 );
+      REQUIRE( map.count( far ) == 0 );
+      REQUIRE( throws<std::out_of_range>( [&] { map[ spel ]; } ) );
+      REQUIRE( throws<std::out_of_range>( [&] { map.insert( std::make_pair( far, CubicalCellData( 1 ) ) ); } ) );
+      REQUIRE( map.empty() );
+      FlatMap unbound;
+      REQUIRE( unbound.count( spel ) == 0 );
+      REQUIRE( unbound.find( spel ) == unbound.end() );
+      REQUIRE( throws<std::out_of_range>( [&] { unbound[ spel ]; } ) );
+    }
+}
+
+SCENARIO( "CubicalComplex< K3, CubicalCellFlatMap > gives the same results as with std::map", "[cubical_complex][flat_map]" )
+{
+  using namespace DGtal::functions;
+
+  KSpace K;
+  K.init( Point( 0, 0, 0 ), Point( 15, 11, 9 ), true );
+  FlatCC flat1( K ), flat2( K );
+  MapCC  map1( K ),  map2( K );
+  randomSpels( K, flat1, map1, 600, 2 );
+  randomSpels( K, flat2, map2, 600, 3 );
+
+  THEN( "Both complexes have the same cells" ) {
+    REQUIRE( cellsOf( flat1 ) == cellsOf( map1 ) );
+  }
+  WHEN( "Closing and opening them" ) {
+    REQUIRE( cellsOf( ~flat1 ) == cellsOf( ~map1 ) );
+    REQUIRE( cellsOf( *~flat1 ) == cellsOf( *~map1 ) );
+    REQUIRE( ( ~flat1 ).euler() == ( ~map1 ).euler() );
+  }
+  WHEN( "Computing stars and links" ) {
+    FlatCC cflat = ~flat1;
+    MapCC  cmap  = ~map1;
+    FlatCC sflat( K );
+    MapCC  smap( K );
+    for ( Integer x = 2; x < 15; x += 4 )
+      {
+        sflat.insertCell( K.uPointel( Point( x, x / 2, x / 3 ) ) );
+        smap.insertCell( K.uPointel( Point( x, x / 2, x / 3 ) ) );
+      }
+    REQUIRE( cellsOf( cflat.star( sflat ) ) == cellsOf( cmap.star( smap ) ) );
+    REQUIRE( cellsOf( cflat.link( sflat ) ) == cellsOf( cmap.link( smap ) ) );
+  }
+  WHEN( "Computing set operations" ) {
+    REQUIRE( cellsOf( flat1 | flat2 ) == cellsOf( map1 | map2 ) );
+    REQUIRE( cellsOf( flat1 & flat2 ) == cellsOf( map1 & map2 ) );
+    REQUIRE( cellsOf( flat1 - flat2 ) == cellsOf( map1 - map2 ) );
+    REQUIRE( cellsOf( flat1 ^ flat2 ) == cellsOf( map1 ^ map2 ) );
+    bool inter_included = ( flat1 & flat2 ) <= flat1;
+    bool not_included   = ! ( flat1 <= ( flat1 & flat2 ) );
+    bool split_equal    = ( ( flat1 - flat2 ) | ( flat1 & flat2 ) ) == flat1;
+    bool different      = flat1 != flat2;
+    FlatCC u = flat1;
+    u |= flat2;
+    u -= flat1;
+    bool diff_equal     = u == flat2 - flat1;
+    REQUIRE( inter_included );
+    REQUIRE( not_included );
+    REQUIRE( split_equal );
+    REQUIRE( different );
+    REQUIRE( diff_equal );
+    REQUIRE( u.nbCells( 3 ) == ( map2 - map1 ).nbCells( 3 ) );
+  }
+  WHEN( "Collapsing the closed complexes" ) {
+    FlatCC cflat = ~flat1;
+    MapCC  cmap  = ~map1;
+    const std::set< Cell > spels = cellsOf( flat1 );
+    std::vector< Cell > S( spels.begin(), spels.end() );
+    FlatCC::DefaultCellMapIteratorPriority Pflat;
+    MapCC::DefaultCellMapIteratorPriority  Pmap;
+    functions::collapse( cflat, S.begin(), S.end(), Pflat, false, true );
+    functions::collapse( cmap,  S.begin(), S.end(), Pmap,  false, true );
+    THEN( "Their Euler characteristics are kept" ) {
+      REQUIRE( cflat.euler() == ( ~flat1 ).euler() );
+      REQUIRE( cmap.euler() == ( ~map1 ).euler() );
+      REQUIRE( cflat.nbCells( 3 ) == 0 );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
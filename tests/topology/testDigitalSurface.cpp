@@ -37,6 +37,8 @@
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
 #include "DGtal/topology/ExplicitDigitalSurface.h"
 #include "DGtal/topology/LightExplicitDigitalSurface.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/topology/helpers/FrontierPredicate.h"
 #include "DGtal/topology/helpers/BoundaryPredicate.h"
@@ -585,6 +587,77 @@ bool testDigitalSurface()
   return nbok == nb;
 }
 
+/**
+ * Checks that surfaces extracted in a space with hashed cell
+ * containers are the same as with the default ordered containers.
+ */
+bool testHashedCellContainers()
+{
+  typedef KhalimskySpaceND< 3, DGtal::int32_t > OKSpace;
+  typedef KhalimskySpaceND< 3, DGtal::int32_t, KhalimskySpaceNDHashedContainers > HKSpace;
+  typedef OKSpace::Space Space;
+  typedef OKSpace::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetSelector < Domain, BIG_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type DigitalSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block ... hashed cell containers" );
+  BOOST_STATIC_ASSERT(( boost::is_same< HKSpace::SurfelSet,
+                        std::unordered_set< HKSpace::SCell > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< HKSpace::CellMap<int>::Type,
+                        std::unordered_map< HKSpace::Cell, int > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< OKSpace::SurfelSet,
+                        std::set< OKSpace::SCell > >::value ));
+  Point p0 = Point::diagonal( 0 );
+  Domain domain( Point::diagonal( -8 ), Point::diagonal( 8 ) );
+  DigitalSet dig_set( domain );
+  Shapes<Domain>::addNorm2Ball( dig_set, p0, 6 );
+  Shapes<Domain>::removeNorm2Ball( dig_set, p0, 3 );
+  OKSpace OK;
+  HKSpace HK;
+  nbok += OK.init( domain.lowerBound(), domain.upperBound(), true ) ? 1 : 0;
+  nbok += HK.init( domain.lowerBound(), domain.upperBound(), true ) ? 1 : 0;
+  nb += 2;
+
+  OKSpace::SCellSet obdry;
+  HKSpace::SCellSet hbdry;
+  Surfaces<OKSpace>::sMakeBoundary( obdry, OK, dig_set,
+                                    domain.lowerBound(), domain.upperBound() );
+  Surfaces<HKSpace>::sMakeBoundary( hbdry, HK, dig_set,
+                                    domain.lowerBound(), domain.upperBound() );
+  bool same = obdry.size() == hbdry.size();
+  for ( OKSpace::SCellSet::const_iterator it = obdry.begin(), itE = obdry.end();
+        same && it != itE; ++it )
+    same = hbdry.count( HK.sCell( OK.sKCoords( *it ), OK.sSign( *it ) ) ) == 1;
+  ++nb; nbok += same ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sMakeBoundary: " << hbdry.size() << " == "
+               << obdry.size() << " surfels" << std::endl;
+
+  OKSpace::SCell obel = Surfaces<OKSpace>::findABel( OK, dig_set, 10000 );
+  HKSpace::SCell hbel = HK.sCell( OK.sKCoords( obel ), OK.sSign( obel ) );
+  SurfelAdjacency<3> SAdj( true );
+  OKSpace::SurfelSet osurf;
+  HKSpace::SurfelSet hsurf;
+  Surfaces<OKSpace>::trackBoundary( osurf, OK, SAdj, dig_set, obel );
+  Surfaces<HKSpace>::trackBoundary( hsurf, HK, SAdj, dig_set, hbel );
+  ++nb; nbok += ( osurf.size() == hsurf.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "trackBoundary: " << hsurf.size() << " == "
+               << osurf.size() << " surfels" << std::endl;
+
+  std::vector< std::vector< HKSpace::SCell > > components;
+  Surfaces<HKSpace>::extractAllConnectedSCell( components, HK, SAdj, dig_set );
+  ++nb; nbok += ( components.size() == 2
+                  && components[ 0 ].size() + components[ 1 ].size() == hbdry.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "extractAllConnectedSCell: " << components.size()
+               << " components" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -603,7 +676,9 @@ int main( int argc, char** argv )
     && testLightExplicitDigitalSurface()
     && testDigitalSurface<KhalimskySpaceND<2> >()
     && testDigitalSurface<KhalimskySpaceND<3> >()
-    && testDigitalSurface<KhalimskySpaceND<4> >();
+    && testDigitalSurface<KhalimskySpaceND<4> >()
+    && testDigitalSurface<KhalimskySpaceND<3, DGtal::int32_t, KhalimskySpaceNDHashedContainers> >()
+    && testHashedCellContainers();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -36,6 +36,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/NeighborhoodConfigurations.h"
 #include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 using namespace std;
 using namespace DGtal;
 using namespace DGtal::functions;
@@ -315,3 +316,81 @@ SCENARIO( "Load isthmus tables", "[isthmus]" ){
     const auto & table = *ptable;
   }
 }
+
+/// Random image of the given density (in percent) and its object.
+template <typename TObject>
+std::pair< ImageContainerBySTLVector< typename TObject::Domain, bool >, TObject >
+randomImageAndObject( const typename TObject::DigitalTopology & dt,
+                      const typename TObject::Domain & domain, int density )
+{
+  ImageContainerBySTLVector< typename TObject::Domain, bool > image( domain );
+  typename TObject::DigitalSet set( domain );
+  for ( auto const & p : domain )
+  {
+    const bool in = rand() % 100 < density;
+    image.setValue( p, in );
+    if ( in ) set.insertNew( p );
+  }
+  return std::make_pair( image, TObject( dt, set ) );
+}
+
+SCENARIO( "Batched configurations match point-wise configurations", "[batch][simple][isthmus]" ){
+  srand( 0 );
+  SECTION("3D, 26_6 simplicity and isthmusicity"){
+    using namespace Z3i;
+    auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+    const Domain domain( Point( -6, -5, -4 ), Point( 70, 4, 6 ) );
+    const auto io = randomImageAndObject<Object26_6>( dt26_6, domain, 40 );
+    const auto & obj = io.second;
+    std::vector< NeighborhoodConfiguration > configurations;
+    computeNeighborhoodConfigurations( io.first, configurations );
+    REQUIRE( configurations.size() == domain.size() );
+    auto simpleTable = loadTable( simplicity::tableSimple26_6 );
+    auto isthmusTable = loadTable( isthmusicity::tableIsthmus );
+    std::vector< unsigned char > flags;
+    classifyNeighborhoodConfigurations( configurations, *simpleTable, 1, flags );
+    classifyNeighborhoodConfigurations( configurations, *isthmusTable, 2, flags );
+    REQUIRE( flags.size() == domain.size() );
+    size_t i = 0, nbok = 0, nbsimple = 0;
+    for ( auto const & p : domain )
+    {
+      const auto cfg = obj.getNeighborhoodConfigurationOccupancy( p, *mapZeroNeighborhoodToMask );
+      bool ok = configurations[ i ] == cfg
+        && ( ( flags[ i ] & 1 ) != 0 ) == (*simpleTable)[ cfg ]
+        && ( ( flags[ i ] & 2 ) != 0 ) == (*isthmusTable)[ cfg ];
+      if ( io.first( p ) )
+      {
+        const bool simple = obj.isSimple( p );
+        ok = ok && simple == ( ( flags[ i ] & 1 ) != 0 );
+        nbsimple += simple ? 1 : 0;
+      }
+      nbok += ok ? 1 : 0;
+      ++i;
+    }
+    CHECK( nbok == domain.size() );
+    CHECK( nbsimple > 0 );
+  }
+  SECTION("2D, 8_4 simplicity"){
+    using namespace Z2i;
+    auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+    const Domain domain( Point( -3, -5 ), Point( 80, 12 ) );
+    const auto io = randomImageAndObject<Object8_4>( dt8_4, domain, 55 );
+    const auto & obj = io.second;
+    std::vector< NeighborhoodConfiguration > configurations;
+    computeNeighborhoodConfigurations( io.first, configurations );
+    auto simpleTable = loadTable<2>( simplicity::tableSimple8_4 );
+    std::vector< unsigned char > flags;
+    classifyNeighborhoodConfigurations( configurations, *simpleTable, 1, flags );
+    size_t i = 0, nbok = 0;
+    for ( auto const & p : domain )
+    {
+      const auto cfg = obj.getNeighborhoodConfigurationOccupancy( p, *mapZeroNeighborhoodToMask );
+      bool ok = configurations[ i ] == cfg;
+      if ( io.first( p ) )
+        ok = ok && obj.isSimple( p ) == ( flags[ i ] != 0 );
+      nbok += ok ? 1 : 0;
+      ++i;
+    }
+    CHECK( nbok == domain.size() );
+  }
+}
@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskyCell.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes PackedKhalimskyCell,
+ * PackedSignedKhalimskyCell and KhalimskyCellPacker.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <set>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskyCell.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskyCellPacker.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Compares every packed operation with the KSpace one, for all cells of K.
+template <typename KSpace>
+void checkAllCells( const KSpace & K )
+{
+  typedef KhalimskyCellPacker< KSpace > Packer;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef HyperRectDomain< typename KSpace::Space > KDomain;
+
+  REQUIRE( Packer::fits( K ) );
+  Packer packer( K );
+  REQUIRE( packer.isValid() );
+  const Point low = K.lowerCell().preCell().coordinates;
+  const Point up  = K.upperCell().preCell().coordinates;
+  KDomain kdomain( low, up );
+  std::set< typename Packer::PackedSCell > packedSet;
+  std::unordered_set< typename Packer::PackedSCell > packedHashSet;
+  std::set< SCell > cellSet;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  for ( const Point & kp : kdomain )
+    {
+      const Cell  c  = K.uCell( kp );
+      const SCell s  = K.sCell( kp, ( kp[ 0 ] & 2 ) != 0 );
+      const auto  pc = packer.pack( c );
+      const auto  ps = packer.pack( s );
+      bool ok = packer.unpack( pc ) == c && packer.unpack( ps ) == s
+        && Packer::uDim( pc ) == K.uDim( c ) && Packer::sDim( ps ) == K.sDim( s )
+        && Packer::sSign( ps ) == K.sSign( s )
+        && packer.unpack( Packer::sOpp( ps ) ) == K.sOpp( s )
+        && Packer::unsigns( ps ) == pc
+        && Packer::uIsSurfel( pc ) == K.uIsSurfel( c );
+      if ( K.sIsSurfel( s ) )
+        ok = ok && Packer::sOrthDir( ps ) == K.sOrthDir( s );
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          ok = ok && Packer::sDirect( ps, k ) == K.sDirect( s, k )
+            && Packer::uIsOpen( pc, k ) == K.uIsOpen( c, k );
+          if ( kp[ k ] < up[ k ] )
+            ok = ok && packer.unpack( Packer::uIncident( pc, k, true ) ) == K.uIncident( c, k, true )
+              && packer.unpack( Packer::sIncident( ps, k, true ) ) == K.sIncident( s, k, true );
+          if ( kp[ k ] > low[ k ] )
+            ok = ok && packer.unpack( Packer::uIncident( pc, k, false ) ) == K.uIncident( c, k, false )
+              && packer.unpack( Packer::sIncident( ps, k, false ) ) == K.sIncident( s, k, false );
+          if ( kp[ k ] > low[ k ] && kp[ k ] < up[ k ] )
+            ok = ok && packer.unpack( Packer::sDirectIncident( ps, k ) ) == K.sDirectIncident( s, k )
+              && packer.unpack( Packer::sIndirectIncident( ps, k ) ) == K.sIndirectIncident( s, k );
+        }
+      ++nb; nbok += ok ? 1 : 0;
+      packedSet.insert( ps );
+      packedSet.insert( Packer::sOpp( ps ) );
+      packedHashSet.insert( ps );
+      packedHashSet.insert( Packer::sOpp( ps ) );
+      cellSet.insert( s );
+      cellSet.insert( K.sOpp( s ) );
+    }
+  REQUIRE( nb == kdomain.size() );
+  REQUIRE( nbok == nb );
+  REQUIRE( packedSet.size() == cellSet.size() );
+  REQUIRE( packedHashSet.size() == cellSet.size() );
+}
+
+TEST_CASE( "Packed cell sizes" )
+{
+  REQUIRE( sizeof( PackedSignedKhalimskyCell< 3 > ) == 8 );
+  REQUIRE( sizeof( PackedKhalimskyCell< 3 > ) == 8 );
+  REQUIRE( sizeof( PackedSignedKhalimskyCell< 3 > ) * 2 <= sizeof( Z3i::SCell ) );
+}
+
+TEST_CASE( "Packed cells of a 2D space" )
+{
+  Z2i::KSpace K;
+  K.init( Z2i::Point( -3, -2 ), Z2i::Point( 4, 3 ), true );
+  checkAllCells( K );
+  Z2i::KSpace Kopen;
+  Kopen.init( Z2i::Point( -3, -2 ), Z2i::Point( 4, 3 ), false );
+  checkAllCells( Kopen );
+}
+
+TEST_CASE( "Packed cells of a 3D space" )
+{
+  Z3i::KSpace K;
+  K.init( Z3i::Point( -3, -2, 1 ), Z3i::Point( 2, 3, 5 ), true );
+  checkAllCells( K );
+  Z3i::KSpace Kopen;
+  Kopen.init( Z3i::Point( -3, -2, 1 ), Z3i::Point( 2, 3, 5 ), false );
+  checkAllCells( Kopen );
+}
+
+TEST_CASE( "Bounds of packable spaces" )
+{
+  typedef KhalimskyCellPacker< Z3i::KSpace > Packer;
+  Z3i::KSpace K;
+  const int n = ( 1 << 20 ) - 1;
+  K.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( n - 1, 1, 1 ), true );
+  REQUIRE( Packer::fits( K ) );
+  K.init( Z3i::Point( 0, 0, 0 ), Z3i::Point( n, 1, 1 ), true );
+  REQUIRE( ! Packer::fits( K ) );
+  K.init( Z3i::Point( -10, 0, 0 ), Z3i::Point( 10, 1, 1 ),
+          { Z3i::KSpace::PERIODIC, Z3i::KSpace::CLOSED, Z3i::KSpace::CLOSED } );
+  REQUIRE( ! Packer::fits( K ) );
+
+  // Cells at the far end of a large space.
+  K.init( Z3i::Point( -n/2, -n/2, -n/2 ), Z3i::Point( n/2 - 1, n/2 - 1, n/2 - 1 ), true );
+  REQUIRE( Packer::fits( K ) );
+  Packer packer( K );
+  const Z3i::SCell s = K.sCell( K.upperCell().preCell().coordinates, K.NEG );
+  REQUIRE( packer.unpack( packer.pack( s ) ) == s );
+  const Z3i::SCell t = K.sCell( K.lowerCell().preCell().coordinates, K.POS );
+  REQUIRE( packer.unpack( packer.pack( t ) ) == t );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
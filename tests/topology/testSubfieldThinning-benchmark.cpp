@@ -0,0 +1,101 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSubfieldThinning-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Scaling benchmark of SubfieldThinning on hollow balls of 256^3 to
+ * 1024^3 voxels, for several numbers of OpenMP threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SubfieldThinning.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class SubfieldThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Thins a hollow ball inscribed in a cube of side @a n, with @a
+/// threads threads, and times the thinning.
+/// @return 'true' if some voxels were removed.
+bool benchmarkSubfieldThinning( int n, int threads )
+{
+  using namespace Z3i;
+#ifdef WITH_OPENMP
+  omp_set_num_threads( threads );
+#endif
+  const auto table = functions::loadTable( simplicity::tableSimple26_6 );
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( n - 1 ) );
+  const Point c = Point::diagonal( n / 2 );
+  const Integer r2 = ( n / 2 - 2 ) * ( n / 2 - 2 );
+  const Integer rc2 = ( n / 8 ) * ( n / 8 );
+  auto inBall = [ & ] ( const Point & p )
+    {
+      const Integer d2 = ( p - c ).dot( p - c );
+      return d2 <= r2 && d2 > rc2;
+    };
+  SubfieldThinning< Space > thinning( domain, *table );
+  thinning.init( inBall );
+
+  std::stringstream sstr;
+  sstr << "Thinning a hollow ball of " << n << "^3 voxels with " << threads << " threads";
+  trace.beginBlock( sstr.str() );
+  const std::size_t removed = thinning.thin();
+  trace.info() << removed << " voxels removed in " << thinning.nbPasses() << " passes" << endl;
+  trace.endBlock();
+  return removed > 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class SubfieldThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  for ( int n : { 256, 512, 1024 } )
+    for ( int threads : { 1, 2, 4, 8 } )
+      res = benchmarkSubfieldThinning( n, threads ) && res;
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSubfieldThinning.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class SubfieldThinning and
+ * functions::parallelThinningScheme.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/topology/SubfieldThinning.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SubfieldThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Numbers of 26-components of a set and of 6-components of its complement.
+std::pair< Space::Size, Space::Size > topologyOf( const Domain & domain, const DigitalSet & set )
+{
+  // The complement is labelled in a larger domain, to join the outside.
+  const Domain large( domain.lowerBound() - Point::diagonal( 1 ),
+                      domain.upperBound() + Point::diagonal( 1 ) );
+  ConnectedComponentLabelling< Space > object( large, Adj26() );
+  ConnectedComponentLabelling< Space > background( large, Adj6() );
+  auto in = [ &set, &domain ] ( const Point & p )
+    { return domain.isInside( p ) && set.find( p ) != set.end(); };
+  return std::make_pair( object.compute( in ),
+                         background.compute( [ &in ] ( const Point & p ) { return ! in( p ); } ) );
+}
+
+/// Hollow ball: a ball with a cavity.
+DigitalSet hollowBall( const Domain & domain, double r, double rc )
+{
+  DigitalSet set( domain );
+  for ( auto const & p : domain )
+    if ( p.norm() <= r && p.norm() > rc ) set.insertNew( p );
+  return set;
+}
+
+/// Solid torus around the z-axis.
+DigitalSet solidTorus( const Domain & domain, double R, double r )
+{
+  DigitalSet set( domain );
+  for ( auto const & p : domain )
+  {
+    const double d = std::sqrt( double( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] ) ) - R;
+    if ( d * d + p[ 2 ] * p[ 2 ] <= r * r ) set.insertNew( p );
+  }
+  return set;
+}
+
+TEST_CASE( "Subfield thinning preserves topology" )
+{
+  const auto simple = functions::loadTable( simplicity::tableSimple26_6 );
+  const Domain domain( Point( -12, -12, -12 ), Point( 12, 12, 12 ) );
+
+  SECTION( "A ball is thinned to a point" )
+  {
+    const DigitalSet set = hollowBall( domain, 7.5, -1.0 );
+    SubfieldThinning< Space > thinning( domain, *simple );
+    REQUIRE( thinning.isValid() );
+    thinning.init( set.begin(), set.end() );
+    REQUIRE( thinning.size() == set.size() );
+    REQUIRE( thinning.thin() == set.size() - 1 );
+    REQUIRE( thinning.size() == 1 );
+  }
+
+  SECTION( "A hollow ball is thinned to a closed surface, a torus to a closed curve" )
+  {
+    for ( const DigitalSet & set : { hollowBall( domain, 8.5, 3.0 ), solidTorus( domain, 7.0, 3.0 ) } )
+    {
+      const auto before = topologyOf( domain, set );
+      SubfieldThinning< Space > thinning( domain, *simple );
+      thinning.init( [ &set ] ( const Point & p ) { return set.find( p ) != set.end(); } );
+      thinning.thin();
+      DigitalSet thin( domain );
+      thinning.writeObject( thin );
+      REQUIRE( thin.size() == thinning.size() );
+      REQUIRE( thin.size() < set.size() / 4 );
+      REQUIRE( topologyOf( domain, thin ) == before );
+      // No simple point remains.
+      unsigned int nbSimple = 0;
+      for ( auto const & p : thin )
+        nbSimple += (*simple)[ thinning.configuration( p ) ] ? 1 : 0;
+      REQUIRE( nbSimple == 0 );
+    }
+  }
+
+  SECTION( "Isthmuses are anchored" )
+  {
+    const auto isthmus = functions::loadTable( isthmusicity::tableIsthmus );
+    const DigitalSet set = solidTorus( domain, 7.0, 3.0 );
+    SubfieldThinning< Space > ultimate( domain, *simple );
+    ultimate.init( set.begin(), set.end() );
+    ultimate.thin();
+    SubfieldThinning< Space > thinning( domain, *simple );
+    thinning.setSkeletonTable( *isthmus );
+    thinning.init( set.begin(), set.end() );
+    thinning.thin();
+    DigitalSet thin( domain );
+    thinning.writeObject( thin );
+    REQUIRE( thinning.size() >= ultimate.size() );
+    REQUIRE( topologyOf( domain, thin ) == topologyOf( domain, set ) );
+    unsigned int nbAnchored = 0;
+    for ( auto const & p : thin ) nbAnchored += thinning.isAnchored( p ) ? 1 : 0;
+    REQUIRE( nbAnchored > 0 );
+  }
+}
+
+TEST_CASE( "Subfield thinning in 2D" )
+{
+  const auto simple = functions::loadTable< 2 >( simplicity::tableSimple8_4 );
+  const Z2i::Domain domain( Z2i::Point( -10, -10 ), Z2i::Point( 10, 10 ) );
+  SubfieldThinning< Z2i::Space > thinning( domain, *simple );
+  // An annulus is thinned to a closed curve.
+  thinning.init( [] ( const Z2i::Point & p ) { return p.norm() <= 8.0 && p.norm() >= 3.0; } );
+  thinning.thin();
+  unsigned int nb = 0, nbSimple = 0;
+  for ( auto const & p : domain )
+    if ( thinning.isInObject( p ) )
+    {
+      ++nb;
+      nbSimple += (*simple)[ thinning.configuration( p ) ] ? 1 : 0;
+      REQUIRE( p.norm() <= 8.0 );
+      REQUIRE( p.norm() >= 3.0 );
+    }
+  REQUIRE( nb == thinning.size() );
+  REQUIRE( nb >= 12 );
+  REQUIRE( nbSimple == 0 );
+}
+
+TEST_CASE( "Parallel thinning scheme of a VoxelComplex" )
+{
+  using TestSet = DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > >;
+  using TestObject = Object< DT26_6, TestSet >;
+  using TestComplex = VoxelComplex< KSpace, TestObject >;
+  const Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  TestSet set( domain );
+  for ( auto const & p : domain )
+    if ( p.norm1() <= 4 ) set.insertNew( p );
+  set.erase( Point::zero );
+  KSpace ks;
+  ks.init( domain.lowerBound(), domain.upperBound(), true );
+  TestComplex vc( ks );
+  vc.construct( TestObject( dt26_6, set ) );
+  REQUIRE_THROWS( functions::parallelThinningScheme( vc ) );
+  vc.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+  const auto thin = functions::parallelThinningScheme( vc );
+  REQUIRE( thin.nbCells( 3 ) > 0 );
+  REQUIRE( thin.nbCells( 3 ) < vc.nbCells( 3 ) );
+  REQUIRE( thin.euler() == vc.euler() );
+  const auto isthmus = functions::loadTable( isthmusicity::tableIsthmus );
+  const auto thinIsthmus = functions::parallelThinningScheme( vc, *isthmus );
+  REQUIRE( thinIsthmus.nbCells( 3 ) >= thin.nbCells( 3 ) );
+  REQUIRE( thinIsthmus.euler() == vc.euler() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////